@@ -554,6 +554,11 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 	uint32 polyCount = READ_LE_UINT32(p);
 	p += 4;
 
+	// All spans of a slice lie on the same screen line
+	byte *linePtr = (byte *)surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+	int bytesPerPixel = surface.format.bytesPerPixel;
+	int maxX = surface.w - 1;
+
 	while (polyCount--) {
 		uint32 vertexCount = READ_LE_UINT32(p);
 		p += 4;
@@ -573,6 +578,18 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 				int vertexZ = (_m21lookup[p[0]] + _m22lookup[p[1]] + _m23) / 64;
 
 				if (vertexZ >= 0 && vertexZ < 65536) {
+					// Skip spans hidden behind what is already drawn before
+					// doing the (expensive) colour calculation
+					int x = previousVertexX;
+					while (x != vertexX && vertexZ >= zbufferLine[x]) {
+						++x;
+					}
+					if (x == vertexX) {
+						p += 3;
+						previousVertexX = vertexX;
+						continue;
+					}
+
 					uint32 outColor = palette.value[p[2]];
 					if (advanced) {
 						Color256 aescColor = { 0, 0, 0 };
@@ -586,12 +603,11 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						outColor = _pixelFormat.RGBToColor(Color::get8BitColorFrom5Bit(color.r), Color::get8BitColorFrom5Bit(color.g), Color::get8BitColorFrom5Bit(color.b));
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
+					for (; x != vertexX; ++x) {
 						if (vertexZ < zbufferLine[x]) {
 							zbufferLine[x] = (uint16)vertexZ;
 
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
+							drawPixel(surface, linePtr + MIN(x, maxX) * bytesPerPixel, outColor);
 						}
 					}
 				}
@@ -142,6 +142,7 @@ VQADecoder::VQADecoder() {
 VQADecoder::~VQADecoder() {
 	for (uint i = _codebooks.size(); i != 0; --i) {
 		delete[] _codebooks[i - 1].data;
+		delete[] _codebooks[i - 1].colors;
 	}
 	delete _audioTrack;
 	delete _videoTrack;
@@ -468,6 +469,7 @@ bool VQADecoder::readCINF(Common::SeekableReadStream *s, uint32 size) {
 		_codebooks[codebookCount - i].frame = s->readUint16LE();
 		_codebooks[codebookCount - i].size  = s->readUint32LE();
 		_codebooks[codebookCount - i].data  = nullptr;
+		_codebooks[codebookCount - i].colors = nullptr;
 
 		// debug("Codebook %2u: %4d %8d", codebookCount - i, _codebooks[codebookCount - i].frame, _codebooks[codebookCount - i].size);
 
@@ -607,8 +609,9 @@ VQADecoder::VQAVideoTrack::VQAVideoTrack(VQADecoder *vqaDecoder) {
 	_maxCBFZSize = header->maxCBFZSize;
 	_maxZBUFChunkSize = vqaDecoder->_maxZBUFChunkSize;
 
-	_codebook = nullptr;
-	_cbfz     = nullptr;
+	_codebook       = nullptr;
+	_codebookColors = nullptr;
+	_cbfz           = nullptr;
 
 	_vpointerSize = 0;
 	_vpointer = nullptr;
@@ -830,15 +833,16 @@ bool VQADecoder::VQAVideoTrack::readVPTR(Common::SeekableReadStream *s, uint32 s
 }
 
 void VQADecoder::VQAVideoTrack::VPTRWriteBlock(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha) {
-	const uint8 *const block_src = &_codebook[2 * srcBlock * _blockW * _blockH];
+	const uint32 blockSize = _blockW * _blockH;
+	const uint8 *const block_src = &_codebook[2 * srcBlock * blockSize];
+	const uint32 *const block_colors = &_codebookColors[srcBlock * blockSize];
+	const uint8 bytesPerPixel = surface->format.bytesPerPixel;
 
 	uint16 blocks_per_line = _width / _blockW;
 
 	uint32 intermDiv = 0;
 	uint32 dst_x = 0;
 	uint32 dst_y = 0;
-	uint16 vqaColor = 0;
-	uint8 a, r, g, b;
 
 	for (uint i = count; i != 0; --i) {
 		intermDiv = (dstBlock + count - i) / blocks_per_line;
@@ -846,26 +850,39 @@ void VQADecoder::VQAVideoTrack::VPTRWriteBlock(Graphics::Surface *surface, unsig
 		dst_y = intermDiv * _blockH + _offsetY;
 
 		const uint8 *src_p = block_src;
+		const uint32 *color_p = block_colors;
 
-		for (uint y = _blockH; y != 0; --y) {
-			for (uint x = _blockW; x != 0; --x) {
-				vqaColor = READ_LE_UINT16(src_p);
-				src_p += 2;
-
-				getGameDataColor(vqaColor, a, r, g, b);
+		for (uint y = 0; y != _blockH; ++y) {
+			// clip is too slow and it is not needed
+			byte *dstPtr = (byte *)surface->getBasePtr(dst_x, dst_y + y);
 
-				if (!(alpha && a)) {
-					// clip is too slow and it is not needed
-					// void* dstPtr = surface->getBasePtr(CLIP(dst_x + x, (uint32)0, (uint32)(surface->w - 1)), CLIP(dst_y + y, (uint32)0, (uint32)(surface->h - 1)));
-					void* dstPtr = surface->getBasePtr(dst_x + _blockW - x, dst_y + _blockH - y);
-					// Ignore the alpha in the output as it is inversed in the input
-					drawPixel(*surface, dstPtr, surface->format.RGBToColor(r, g, b));
+			for (uint x = _blockW; x != 0; --x) {
+				// The alpha is in the high bit of the game data color
+				if (!(alpha && (src_p[1] & 0x80))) {
+					drawPixel(*surface, dstPtr, *color_p);
 				}
+				src_p += 2;
+				++color_p;
+				dstPtr += bytesPerPixel;
 			}
 		}
 	}
 }
 
+void VQADecoder::VQAVideoTrack::convertCodebook(CodebookInfo &codebookInfo, const Graphics::PixelFormat &format) {
+	uint32 colorCount = _maxBlocks * _blockW * _blockH;
+	codebookInfo.colors = new uint32[colorCount];
+
+	const uint8 *src = codebookInfo.data;
+	uint8 a, r, g, b;
+	for (uint32 i = 0; i != colorCount; ++i) {
+		getGameDataColor(READ_LE_UINT16(src), a, r, g, b);
+		// Ignore the alpha in the output as it is inversed in the input
+		codebookInfo.colors[i] = format.RGBToColor(r, g, b);
+		src += 2;
+	}
+}
+
 bool VQADecoder::VQAVideoTrack::decodeFrame(Graphics::Surface *surface) {
 	CodebookInfo &codebookInfo = _vqaDecoder->codebookInfoForFrame(_vqaDecoder->_decodingFrame);
 
@@ -877,6 +894,11 @@ bool VQADecoder::VQAVideoTrack::decodeFrame(Graphics::Surface *surface) {
 	if (!_codebook || !_vpointer)
 		return false;
 
+	if (!codebookInfo.colors) {
+		convertCodebook(codebookInfo, surface->format);
+	}
+	_codebookColors = codebookInfo.colors;
+
 	uint8 *src = _vpointer;
 	uint8 *end = _vpointer + _vpointerSize;
 
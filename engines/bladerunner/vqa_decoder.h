@@ -134,6 +134,7 @@ public:
 		uint16  frame;
 		uint32  size;
 		uint8  *data;
+		uint32 *colors; // data converted to the screen format, created on first use
 	};
 
 	class VQAVideoTrack;
@@ -217,6 +218,7 @@ public:
 		uint32  _maxZBUFChunkSize;
 
 		uint8   *_codebook;
+		uint32  *_codebookColors;
 		uint8   *_cbfz;
 		uint32   _zbufChunkSize;
 		uint8   *_zbufChunk;
@@ -233,6 +235,7 @@ public:
 		uint8   *_screenEffectsData;
 		uint32   _screenEffectsDataSize;
 
+		void convertCodebook(CodebookInfo &codebookInfo, const Graphics::PixelFormat &format);
 		void VPTRWriteBlock(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha = false);
 		bool decodeFrame(Graphics::Surface *surface);
 	};
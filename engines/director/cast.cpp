@@ -520,7 +520,8 @@ void Cast::loadCastChildren() {
 		uint16 realId = 0;
 
 		Image::ImageDecoder *img = NULL;
-		Common::SeekableReadStream *pic = NULL;
+		Archive *archive = NULL;
+		uint16 resId = 0;
 
 		if (_version >= kFileVer400) {
 			if (bitmapCast->_children.size() > 0) {
@@ -528,23 +529,25 @@ void Cast::loadCastChildren() {
 				tag = bitmapCast->_children[0].tag;
 
 				if (_castArchive->hasResource(tag, imgId))
-					pic = _castArchive->getResource(tag, imgId);
+					archive = _castArchive;
 				else if (sharedCast && sharedCast->getArchive()->hasResource(tag, imgId))
-					pic = sharedCast->getArchive()->getResource(tag, imgId);
+					archive = sharedCast->getArchive();
+				resId = imgId;
 			}
 		} else {
 			if (_loadedCast->contains(imgId)) {
 				bitmapCast->_tag = tag = ((BitmapCastMember *)_loadedCast->getVal(imgId))->_tag;
 				realId = imgId + _castIDoffset;
-				pic = _castArchive->getResource(tag, realId);
+				archive = _castArchive;
 			} else if (sharedCast && sharedCast->_loadedCast && sharedCast->_loadedCast->contains(imgId)) {
 				bitmapCast->_tag = tag = ((BitmapCastMember *)sharedCast->_loadedCast->getVal(imgId))->_tag;
 				realId = imgId + sharedCast->_castIDoffset;
-				pic = sharedCast->getArchive()->getResource(tag, realId);
+				archive = sharedCast->getArchive();
 			}
+			resId = realId;
 		}
 
-		if (pic == NULL) {
+		if (archive == NULL) {
 			warning("Cast::loadCastChildren(): Bitmap image %d not found", imgId);
 			continue;
 		}
@@ -554,12 +557,12 @@ void Cast::loadCastChildren() {
 
 		switch (tag) {
 		case MKTAG('D', 'I', 'B', ' '):
-			debugC(2, kDebugLoading, "****** Loading 'DIB ' id: %d (%d), %d bytes", imgId, realId, (int)pic->size());
+			debugC(2, kDebugLoading, "****** Preparing 'DIB ' id: %d (%d)", imgId, realId);
 			img = new DIBDecoder();
 			break;
 
 		case MKTAG('B', 'I', 'T', 'D'):
-			debugC(2, kDebugLoading, "****** Loading 'BITD' id: %d (%d), %d bytes", imgId, realId, (int)pic->size());
+			debugC(2, kDebugLoading, "****** Preparing 'BITD' id: %d (%d)", imgId, realId);
 
 			if (w > 0 && h > 0) {
 				if (_version < kFileVer600) {
@@ -581,13 +584,12 @@ void Cast::loadCastChildren() {
 		if (!img)
 			continue;
 
-		img->loadStream(*pic);
-
-		bitmapCast->_img = img;
-		const Graphics::Surface *surf = img->getSurface();
-		bitmapCast->_size = surf->pitch * surf->h + img->getPaletteColorCount() * 3;
-
-		delete pic;
+		// The pixel data itself is only decoded when the member is first used.
+		// 32-bit images are matched against the current palette while decoding,
+		// so those still have to be converted now.
+		bitmapCast->setImageSource(img, archive, tag, resId);
+		if (bitmapCast->_bitsPerPixel == 32)
+			bitmapCast->loadImage();
 
 		debugC(4, kDebugImages, "Cast::loadCastChildren(): Bitmap: id: %d, w: %d, h: %d, flags1: %x, flags2: %x bytes: %x, bpp: %d clut: %x", imgId, w, h, bitmapCast->_flags1, bitmapCast->_flags2, bitmapCast->_bytes, bitmapCast->_bitsPerPixel, bitmapCast->_clut);
 	}
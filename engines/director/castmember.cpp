@@ -65,6 +65,10 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Common::SeekableRe
 		: CastMember(cast, castId, stream) {
 	_type = kCastBitmap;
 	_img = nullptr;
+	_imgLoaded = false;
+	_imgArchive = nullptr;
+	_imgTag = 0;
+	_imgResId = 0;
 	_matte = nullptr;
 	_noMatte = false;
 	_bytes = 0;
@@ -175,12 +179,50 @@ BitmapCastMember::~BitmapCastMember() {
 		delete _matte;
 }
 
+void BitmapCastMember::setImageSource(Image::ImageDecoder *img, Archive *archive, uint32 tag, uint16 resId) {
+	delete _img;
+
+	_img = img;
+	_imgLoaded = false;
+	_imgArchive = archive;
+	_imgTag = tag;
+	_imgResId = resId;
+}
+
+bool BitmapCastMember::loadImage() {
+	if (!_img)
+		return false;
+
+	if (_imgLoaded)
+		return true;
+
+	_imgLoaded = true;
+
+	Common::SeekableReadStream *pic = _imgArchive ? _imgArchive->getResource(_imgTag, _imgResId) : nullptr;
+	if (!pic) {
+		warning("BitmapCastMember::loadImage(): Bitmap image %d not found", _castId);
+		return false;
+	}
+
+	debugC(2, kDebugLoading, "****** Loading '%s' id: %d, %d bytes", tag2str(_imgTag), _imgResId, (int)pic->size());
+
+	_img->loadStream(*pic);
+	delete pic;
+
+	const Graphics::Surface *surf = _img->getSurface();
+	_size = surf->pitch * surf->h + _img->getPaletteColorCount() * 3;
+
+	return true;
+}
+
 Graphics::MacWidget *BitmapCastMember::createWidget(Common::Rect &bbox, Channel *channel, SpriteType spriteType) {
 	if (!_img) {
 		warning("BitmapCastMember::createWidget: No image decoder");
 		return nullptr;
 	}
 
+	loadImage();
+
 	Graphics::MacWidget *widget = new Graphics::MacWidget(g_director->getCurrentWindow(), bbox.left, bbox.top, bbox.width(), bbox.height(), g_director->_wm, false);
 
 	// scale for drawing a different size sprite
@@ -190,6 +232,8 @@ Graphics::MacWidget *BitmapCastMember::createWidget(Common::Rect &bbox, Channel
 }
 
 void BitmapCastMember::copyStretchImg(Graphics::Surface *surface, const Common::Rect &bbox) {
+	loadImage();
+
 	if (bbox.width() != _initialRect.width() || bbox.height() != _initialRect.height()) {
 
 		int scaleX = SCALE_THRESHOLD * _initialRect.width() / bbox.width();
@@ -120,6 +120,9 @@ public:
 	Graphics::Surface *getMatte(Common::Rect &bbox);
 	void copyStretchImg(Graphics::Surface *surface, const Common::Rect &bbox);
 
+	void setImageSource(Image::ImageDecoder *img, Archive *archive, uint32 tag, uint16 resId);
+	bool loadImage();
+
 	bool hasField(int field) override;
 	Datum getField(int field) override;
 	bool setField(int field, const Datum &value) override;
@@ -127,6 +130,12 @@ public:
 	Image::ImageDecoder *_img;
 	Graphics::FloodFill *_matte;
 
+	// Image data is decoded by loadImage() on first use
+	bool _imgLoaded;
+	Archive *_imgArchive;
+	uint32 _imgTag;
+	uint16 _imgResId;
+
 	uint16 _pitch;
 	uint16 _regX;
 	uint16 _regY;
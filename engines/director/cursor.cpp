@@ -70,6 +70,9 @@ void Cursor::readFromCast(CastMemberID cursorId, CastMemberID maskId) {
 	BitmapCastMember *cursorBitmap = (BitmapCastMember *)cursorCast;
 	BitmapCastMember *maskBitmap = (BitmapCastMember *)maskCast;
 
+	cursorBitmap->loadImage();
+	maskBitmap->loadImage();
+
 	_surface = new byte[getWidth() * getHeight()];
 	byte *dst = _surface;
 
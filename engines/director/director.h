@@ -142,6 +142,7 @@ struct DirectorPlotData {
 	bool applyColor;
 
 	void setApplyColor(); // graphics.cpp
+	uint32 applyCopyColor(uint32 src); // graphics.cpp
 
 	DirectorPlotData(Graphics::MacWindowManager *w, SpriteType s, InkType i, int a, uint32 b, uint32 f) : _wm(w), sprite(s), ink(i), alpha(a), backColor(b), foreColor(f) {
 		srf = nullptr;
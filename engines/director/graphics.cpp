@@ -188,20 +188,7 @@ void inkDrawPixel(int x, int y, int src, void *data) {
 		// Only unmasked pixels make it here, so copy them straight
 	case kInkTypeCopy: {
 		if (p->applyColor) {
-			// TODO: Improve the efficiency of this composition
-			byte rSrc, gSrc, bSrc;
-			byte rDst, gDst, bDst;
-			byte rFor, gFor, bFor;
-			byte rBak, gBak, bBak;
-
-			g_director->_wm->decomposeColor(src, rSrc, gSrc, bSrc);
-			g_director->_wm->decomposeColor(*dst, rDst, gDst, bDst);
-			g_director->_wm->decomposeColor(p->foreColor, rFor, gFor, bFor);
-			g_director->_wm->decomposeColor(p->backColor, rBak, gBak, bBak);
-
-			*dst = p->_wm->findBestColor((rSrc | rFor) & (~rSrc | rBak),
-																	 (gSrc | gFor) & (~gSrc | gBak),
-																	 (bSrc | bFor) & (~bSrc | bBak));
+			*dst = p->applyCopyColor(src);
 		} else {
 			*dst = src;
 		}
@@ -292,6 +279,21 @@ Graphics::MacDrawPixPtr DirectorEngine::getInkDrawPixel() {
 		return &inkDrawPixel<uint32 *>;
 }
 
+uint32 DirectorPlotData::applyCopyColor(uint32 src) {
+	// TODO: Improve the efficiency of this composition
+	byte rSrc, gSrc, bSrc;
+	byte rFor, gFor, bFor;
+	byte rBak, gBak, bBak;
+
+	_wm->decomposeColor(src, rSrc, gSrc, bSrc);
+	_wm->decomposeColor(foreColor, rFor, gFor, bFor);
+	_wm->decomposeColor(backColor, rBak, gBak, bBak);
+
+	return _wm->findBestColor((rSrc | rFor) & (~rSrc | rBak),
+							  (gSrc | gFor) & (~gSrc | gBak),
+							  (bSrc | bFor) & (~bSrc | bBak));
+}
+
 void DirectorPlotData::setApplyColor() {
 	applyColor = false;
 
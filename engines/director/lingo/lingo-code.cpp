@@ -1432,26 +1432,26 @@ void LC::call(const Common::String &name, int nargs, bool allowRetVal) {
 		}
 	}
 
-	// Handler
-	funcSym = g_lingo->getHandler(name);
-
-	// Builtin
-	if (allowRetVal) {
-		if (g_lingo->_builtinFuncs.contains(name)) {
-			funcSym = g_lingo->_builtinFuncs[name];
-		}
+	// Builtin. These take precedence over handlers of the same name,
+	// so the handler lookup is only needed when there is no builtin.
+	SymbolHash &builtins = allowRetVal ? g_lingo->_builtinFuncs : g_lingo->_builtinCmds;
+	SymbolHash::iterator bltin = builtins.find(name);
+	if (bltin != builtins.end()) {
+		funcSym = bltin->_value;
 	} else {
-		if (g_lingo->_builtinCmds.contains(name)) {
-			funcSym = g_lingo->_builtinCmds[name];
-		}
+		// Handler
+		funcSym = g_lingo->getHandler(name);
 	}
 
 	// use lingo-the as fallback. we can only use functions as fallback, not properties
-	if (funcSym.type == VOIDSYM && g_lingo->_theEntities.contains(name) && g_lingo->_theEntities[name]->isFunction) {
-		Datum id;
-		Datum res = g_lingo->getTheEntity(g_lingo->_theEntities[name]->entity, id, kTheNOField);
-		g_lingo->push(res);
-		return;
+	if (funcSym.type == VOIDSYM) {
+		TheEntityHash::iterator entity = g_lingo->_theEntities.find(name);
+		if (entity != g_lingo->_theEntities.end() && entity->_value->isFunction) {
+			Datum id;
+			Datum res = g_lingo->getTheEntity(entity->_value->entity, id, kTheNOField);
+			g_lingo->push(res);
+			return;
+		}
 	}
 
 	call(funcSym, nargs, allowRetVal);
@@ -245,8 +245,9 @@ Symbol ScriptContext::define(const Common::String &name, ScriptData *code, Commo
 Symbol ScriptContext::getMethod(const Common::String &methodName) {
 	Symbol sym;
 
-	if (_functionHandlers.contains(methodName)) {
-		sym = _functionHandlers[methodName];
+	SymbolHash::iterator it = _functionHandlers.find(methodName);
+	if (it != _functionHandlers.end()) {
+		sym = it->_value;
 		sym.target = this;
 		return sym;
 	}
@@ -255,18 +256,28 @@ Symbol ScriptContext::getMethod(const Common::String &methodName) {
 	if (sym.type != VOIDSYM)
 		return sym;
 
-	if (_objType == kScriptObj) {
-		if (_properties.contains("ancestor") && _properties["ancestor"].type == OBJECT
-				&& (_properties["ancestor"].u.obj->getObjType() & (kScriptObj | kXtraObj))) {
-			// ancestor method
-			debugC(3, kDebugLingoExec, "Calling method '%s' on ancestor: <%s>", methodName.c_str(), _properties["ancestor"].asString(true).c_str());
-			return _properties["ancestor"].u.obj->getMethod(methodName);
-		}
+	AbstractObject *ancestor = getAncestor();
+	if (ancestor) {
+		// ancestor method
+		debugC(3, kDebugLingoExec, "Calling method '%s' on ancestor: <%s>", methodName.c_str(), ancestor->asString().c_str());
+		return ancestor->getMethod(methodName);
 	}
 
 	return sym;
 }
 
+AbstractObject *ScriptContext::getAncestor() {
+	if (_objType != kScriptObj)
+		return nullptr;
+
+	DatumHash::iterator it = _properties.find("ancestor");
+	if (it == _properties.end() || it->_value.type != OBJECT
+			|| !(it->_value.u.obj->getObjType() & (kScriptObj | kXtraObj)))
+		return nullptr;
+
+	return it->_value.u.obj;
+}
+
 bool ScriptContext::hasProp(const Common::String &propName) {
 	if (_disposed) {
 		error("Property '%s' accessed on disposed object <%s>", propName.c_str(), Datum(this).asString(true).c_str());
@@ -274,11 +285,9 @@ bool ScriptContext::hasProp(const Common::String &propName) {
 	if (_properties.contains(propName)) {
 		return true;
 	}
-	if (_objType == kScriptObj) {
-		if (_properties.contains("ancestor") && _properties["ancestor"].type == OBJECT
-				&& (_properties["ancestor"].u.obj->getObjType() & (kScriptObj | kXtraObj))) {
-			return _properties["ancestor"].u.obj->hasProp(propName);
-		}
+	AbstractObject *ancestor = getAncestor();
+	if (ancestor) {
+		return ancestor->hasProp(propName);
 	}
 	return false;
 }
@@ -287,15 +296,14 @@ Datum ScriptContext::getProp(const Common::String &propName) {
 	if (_disposed) {
 		error("Property '%s' accessed on disposed object <%s>", propName.c_str(), Datum(this).asString(true).c_str());
 	}
-	if (_properties.contains(propName)) {
-		return _properties[propName];
+	DatumHash::iterator it = _properties.find(propName);
+	if (it != _properties.end()) {
+		return it->_value;
 	}
-	if (_objType == kScriptObj) {
-		if (_properties.contains("ancestor") && _properties["ancestor"].type == OBJECT
-				&& (_properties["ancestor"].u.obj->getObjType() & (kScriptObj | kXtraObj))) {
-			debugC(3, kDebugLingoExec, "Getting prop '%s' from ancestor: <%s>", propName.c_str(), _properties["ancestor"].asString(true).c_str());
-			return _properties["ancestor"].u.obj->getProp(propName);
-		}
+	AbstractObject *ancestor = getAncestor();
+	if (ancestor) {
+		debugC(3, kDebugLingoExec, "Getting prop '%s' from ancestor: <%s>", propName.c_str(), ancestor->asString().c_str());
+		return ancestor->getProp(propName);
 	}
 	return _properties[propName]; // return new property
 }
@@ -304,16 +312,15 @@ bool ScriptContext::setProp(const Common::String &propName, const Datum &value)
 	if (_disposed) {
 		error("Property '%s' accessed on disposed object <%s>", propName.c_str(), Datum(this).asString(true).c_str());
 	}
-	if (_properties.contains(propName)) {
-		_properties[propName] = value;
+	DatumHash::iterator it = _properties.find(propName);
+	if (it != _properties.end()) {
+		it->_value = value;
 		return true;
 	}
-	if (_objType == kScriptObj) {
-		if (_properties.contains("ancestor") && _properties["ancestor"].type == OBJECT
-				&& (_properties["ancestor"].u.obj->getObjType() & (kScriptObj | kXtraObj))) {
-			debugC(3, kDebugLingoExec, "Getting prop '%s' from ancestor: <%s>", propName.c_str(), _properties["ancestor"].asString(true).c_str());
-			return _properties["ancestor"].u.obj->setProp(propName, value);
-		}
+	AbstractObject *ancestor = getAncestor();
+	if (ancestor) {
+		debugC(3, kDebugLingoExec, "Getting prop '%s' from ancestor: <%s>", propName.c_str(), ancestor->asString().c_str());
+		return ancestor->setProp(propName, value);
 	}
 	return false;
 }
@@ -831,6 +838,11 @@ Datum BitmapCastMember::getField(int field) {
 	case kThePicture:
 		warning("STUB: BitmapCastMember::getField(): Unprocessed getting field \"%s\" of cast %d", g_lingo->field2str(field), _castId);
 		break;
+	case kTheSize:
+		// The size is only known once the image has been decoded
+		loadImage();
+		d = (int)_size;
+		break;
 	default:
 		d = CastMember::getField(field);
 	}
@@ -212,6 +212,10 @@ public:
 	bool setProp(const Common::String &propName, const Datum &value) override;
 
 	Symbol define(const Common::String &name, ScriptData *code, Common::Array<Common::String> *argNames, Common::Array<Common::String> *varNames);
+
+private:
+	// The script or Xtra object that properties and methods are inherited from, if any
+	AbstractObject *getAncestor();
 };
 
 namespace LM {
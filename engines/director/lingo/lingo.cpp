@@ -237,8 +237,11 @@ Common::String LingoArchive::getName(uint16 id) {
 Symbol Lingo::getHandler(const Common::String &name) {
 	if (!_eventHandlerTypeIds.contains(name)) {
 		// local functions
-		if (_currentScriptContext && _currentScriptContext->_functionHandlers.contains(name))
-			return _currentScriptContext->_functionHandlers[name];
+		if (_currentScriptContext) {
+			SymbolHash::iterator it = _currentScriptContext->_functionHandlers.find(name);
+			if (it != _currentScriptContext->_functionHandlers.end())
+				return it->_value;
+		}
 
 		Symbol sym = g_director->getCurrentMovie()->getHandler(name);
 		if (sym.type != VOIDSYM)
@@ -403,7 +406,6 @@ void Lingo::execute(uint pc) {
 			break;
 		}
 
-		Common::String instr = decodeInstruction(_currentArchive, _currentScript, _pc);
 		uint current = _pc;
 
 		if (debugChannelSet(5, kDebugLingoExec))
@@ -416,7 +418,11 @@ void Lingo::execute(uint pc) {
 				debug("me: %s", _currentMe.asString(true).c_str());
 		}
 
-		debugC(3, kDebugLingoExec, "[%3d]: %s", current, instr.c_str());
+		// Disassembling the instruction is costly, only do it when it is going to be printed
+		if (debugChannelSet(3, kDebugLingoExec)) {
+			Common::String instr = decodeInstruction(_currentArchive, _currentScript, _pc);
+			debugC(3, kDebugLingoExec, "[%3d]: %s", current, instr.c_str());
+		}
 
 		_pc++;
 		(*((*_currentScript)[_pc - 1]))();
@@ -1109,10 +1115,13 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Common::String name = *var.u.s;
-			if (_localvars && _localvars->contains(name)) {
-				(*_localvars)[name] = value;
-				return;
+			const Common::String &name = *var.u.s;
+			if (_localvars) {
+				DatumHash::iterator it = _localvars->find(name);
+				if (it != _localvars->end()) {
+					it->_value = value;
+					return;
+				}
 			}
 			if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 				_currentMe.u.obj->setProp(name, value);
@@ -1130,9 +1139,10 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_localvars && _localvars->contains(name)) {
-				(*_localvars)[name] = value;
+			const Common::String &name = *var.u.s;
+			DatumHash::iterator it;
+			if (_localvars && (it = _localvars->find(name)) != _localvars->end()) {
+				it->_value = value;
 			} else {
 				warning("varAssign: local variable %s not defined", name.c_str());
 			}
@@ -1140,7 +1150,7 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 				_currentMe.u.obj->setProp(name, value);
 			} else {
@@ -1220,17 +1230,19 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Datum d;
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 
-			if (_localvars && _localvars->contains(name)) {
-				return (*_localvars)[name];
+			if (_localvars) {
+				DatumHash::const_iterator it = _localvars->find(name);
+				if (it != _localvars->end())
+					return it->_value;
 			}
 			if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 				return _currentMe.u.obj->getProp(name);
 			}
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::const_iterator it = _globalvars.find(name);
+			if (it != _globalvars.end()) {
+				return it->_value;
 			}
 
 			if (!silent)
@@ -1240,9 +1252,10 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case GLOBALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			const Common::String &name = *var.u.s;
+			DatumHash::const_iterator it = _globalvars.find(name);
+			if (it != _globalvars.end()) {
+				return it->_value;
 			}
 			warning("varFetch: global variable %s not defined", name.c_str());
 			return result;
@@ -1250,9 +1263,11 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_localvars && _localvars->contains(name)) {
-				return (*_localvars)[name];
+			const Common::String &name = *var.u.s;
+			if (_localvars) {
+				DatumHash::const_iterator it = _localvars->find(name);
+				if (it != _localvars->end())
+					return it->_value;
 			}
 			warning("varFetch: local variable %s not defined", name.c_str());
 			return result;
@@ -1260,7 +1275,7 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 				return _currentMe.u.obj->getProp(name);
 			}
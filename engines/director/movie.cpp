@@ -373,11 +373,15 @@ ScriptContext *Movie::getScriptContext(ScriptType type, CastMemberID id) {
 
 Symbol Movie::getHandler(const Common::String &name) {
 	if (!g_lingo->_eventHandlerTypeIds.contains(name)) {
-		if (_cast->_lingoArchive->functionHandlers.contains(name))
-			return _cast->_lingoArchive->functionHandlers[name];
-
-		if (_sharedCast && _sharedCast->_lingoArchive->functionHandlers.contains(name))
-			return _sharedCast->_lingoArchive->functionHandlers[name];
+		SymbolHash::iterator it = _cast->_lingoArchive->functionHandlers.find(name);
+		if (it != _cast->_lingoArchive->functionHandlers.end())
+			return it->_value;
+
+		if (_sharedCast) {
+			it = _sharedCast->_lingoArchive->functionHandlers.find(name);
+			if (it != _sharedCast->_lingoArchive->functionHandlers.end())
+				return it->_value;
+		}
 	}
 	return Symbol();
 }
@@ -261,6 +261,9 @@ void Window::inkBlitSurface(DirectorPlotData *pd, Common::Rect &srcRect, const G
 	if (pd->sprite == kTextSprite)
 		pd->applyColor = false;
 
+	if (inkBlitCopySurface(pd, srcRect, mask))
+		return;
+
 	pd->srcPoint.y = abs(srcRect.top - pd->destRect.top);
 	for (int i = 0; i < pd->destRect.height(); i++, pd->srcPoint.y++) {
 		if (_wm->_pixelformat.bytesPerPixel == 1) {
@@ -287,6 +290,65 @@ void Window::inkBlitSurface(DirectorPlotData *pd, Common::Rect &srcRect, const G
 	}
 }
 
+bool Window::inkBlitCopySurface(DirectorPlotData *pd, Common::Rect &srcRect, const Graphics::Surface *mask) {
+	// With copy-like inks in 8bpp the result only depends on the source pixel,
+	// not on what is already on the stage. Resolve each palette index through
+	// the ink once per blit instead of going through inkDrawPixel for every pixel.
+	if (_wm->_pixelformat.bytesPerPixel != 1 || pd->alpha)
+		return false;
+
+	switch (pd->ink) {
+	case kInkTypeCopy:
+	case kInkTypeMatte:
+	case kInkTypeMask:
+	case kInkTypeBackgndTrans:
+		break;
+	default:
+		return false;
+	}
+
+	enum {
+		kColorUnresolved = -2,
+		kColorTransparent = -1
+	};
+
+	int16 colorMap[256];
+	for (int i = 0; i < 256; i++)
+		colorMap[i] = kColorUnresolved;
+
+	const int width = pd->destRect.width();
+	pd->srcPoint.x = abs(srcRect.left - pd->destRect.left);
+	pd->srcPoint.y = abs(srcRect.top - pd->destRect.top);
+
+	for (int i = 0; i < pd->destRect.height(); i++, pd->srcPoint.y++) {
+		const byte *src = (const byte *)pd->srf->getBasePtr(pd->srcPoint.x, pd->srcPoint.y);
+		const byte *msk = mask ? (const byte *)mask->getBasePtr(pd->srcPoint.x, pd->srcPoint.y) : nullptr;
+		byte *dst = (byte *)pd->dst->getBasePtr(pd->destRect.left, pd->destRect.top + i);
+
+		for (int j = 0; j < width; j++, src++, dst++) {
+			if (msk && *msk++)
+				continue;
+
+			int16 color = colorMap[*src];
+			if (color == kColorUnresolved) {
+				uint32 c = preprocessColor(pd, *src);
+
+				if (pd->ink == kInkTypeBackgndTrans && c == pd->backColor)
+					color = kColorTransparent;
+				else
+					color = (byte)(pd->applyColor ? pd->applyCopyColor(c) : c);
+
+				colorMap[*src] = color;
+			}
+
+			if (color != kColorTransparent)
+				*dst = (byte)color;
+		}
+	}
+
+	return true;
+}
+
 void Window::inkBlitStretchSurface(DirectorPlotData *pd, Common::Rect &srcRect, const Graphics::Surface *mask) {
 	if (!pd->srf)
 		return;
@@ -194,6 +194,7 @@ private:
 	void inkBlitShape(DirectorPlotData *pd, Common::Rect &srcRect);
 
 	void inkBlitSurface(DirectorPlotData *pd, Common::Rect &srcRect, const Graphics::Surface *mask);
+	bool inkBlitCopySurface(DirectorPlotData *pd, Common::Rect &srcRect, const Graphics::Surface *mask);
 	void inkBlitStretchSurface(DirectorPlotData *pd, Common::Rect &srcRect, const Graphics::Surface *mask);
 };
 
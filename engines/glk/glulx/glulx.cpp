@@ -49,6 +49,14 @@ Glulx::Glulx(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst, g
 		iosys_mode(0), iosys_rock(0), tablecache_valid(false), glkio_unichar_han_ptr(nullptr) {
 	g_vm = this;
 
+#if VM_PROFILING
+	profiling_active = false;
+	profiling_stream = nullptr;
+	profiling_filename = nullptr;
+	profile_functions = nullptr;
+	profile_current_frame = nullptr;
+#endif /* VM_PROFILING */
+
 	glkopInit();
 }
 
@@ -66,6 +74,11 @@ void Glulx::runGame() {
 	if (library_autorestore_hook)
 		library_autorestore_hook();
 
+#if VM_PROFILING
+	if (!init_profile())
+		warning("Unable to start the Glulx profiler");
+#endif /* VM_PROFILING */
+
 	execute_loop();
 	finalize_vm();
 
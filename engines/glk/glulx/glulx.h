@@ -822,6 +822,14 @@ public:
 
 	#if VM_PROFILING
 	uint profile_opcount;
+	bool profiling_active;
+	strid_t profiling_stream;
+	const char *profiling_filename;
+	profile_function_t **profile_functions;
+	profile_frame_t *profile_current_frame;
+
+	profile_function_t *profile_get_function(uint addr);
+	void profile_write_results();
 	#define profile_tick() (profile_opcount++)
 	int profile_profiling_active();
 	void profile_in(uint addr, uint stackuse, int accel);
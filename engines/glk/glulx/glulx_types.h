@@ -45,7 +45,8 @@ class Glulx;
 
 /**
  * Uncomment this definition to turn on Glulx VM profiling. In this mode, all function calls are timed,
- * and the timing information is written to a data file called "profile-raw".
+ * and the timing information is written to a data file called "profile-raw". The functions executing
+ * the most opcodes of their own are also listed in the debug output, as candidates for acceleration.
  * (Build note: on Linux, glibc may require you to also define _BSD_SOURCE or _DEFAULT_SOURCE or both
  * for the timeradd() macro.)
  */
@@ -418,6 +419,45 @@ struct cacheblock_struct {
 };
 typedef cacheblock_struct cacheblock_t;
 
+#if VM_PROFILING
+
+/**
+ * Profiling statistics gathered for a single function (or accelerated function / opcode)
+ */
+struct profile_function_struct {
+	uint addr;
+	uint call_count;
+	uint accel_count;
+	uint entry_depth;
+	uint entry_start_time;
+	uint entry_start_op;
+	uint max_depth;
+	uint max_stack_use;
+	uint total_time;
+	uint total_ops;
+	uint self_time;
+	uint self_ops;
+	profile_function_struct *hash_next;
+};
+typedef profile_function_struct profile_function_t;
+
+/**
+ * One entry of the profiler's call stack
+ */
+struct profile_frame_struct {
+	profile_frame_struct *parent;
+	profile_function_t *func;
+	uint entry_time;
+	uint entry_op;
+	uint children_time;
+	uint children_ops;
+};
+typedef profile_frame_struct profile_frame_t;
+
+#define PROFILE_HASH_SIZE (511)
+
+#endif /* VM_PROFILING */
+
 } // End of namespace Glulx
 } // End of namespace Glk
 
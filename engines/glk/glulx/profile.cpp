@@ -0,0 +1,261 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "glk/glulx/glulx.h"
+
+#if VM_PROFILING
+
+#include "common/file.h"
+#include "common/system.h"
+
+namespace Glk {
+namespace Glulx {
+
+/**
+ * Number of functions listed in the debug summary written when the game quits
+ */
+#define PROFILE_SUMMARY_COUNT (20)
+
+void Glulx::setup_profile(strid_t stream, char *filename) {
+	profiling_stream = stream;
+	profiling_filename = filename;
+}
+
+int Glulx::init_profile() {
+	int bucknum;
+
+	profile_opcount = 0;
+	profile_current_frame = nullptr;
+
+	profile_functions = (profile_function_t **)glulx_malloc(PROFILE_HASH_SIZE * sizeof(profile_function_t *));
+	if (!profile_functions)
+		return false;
+
+	for (bucknum = 0; bucknum < PROFILE_HASH_SIZE; bucknum++)
+		profile_functions[bucknum] = nullptr;
+
+	profiling_active = true;
+	return true;
+}
+
+int Glulx::profile_profiling_active() {
+	return profiling_active;
+}
+
+profile_function_t *Glulx::profile_get_function(uint addr) {
+	int bucknum = (addr % PROFILE_HASH_SIZE);
+	profile_function_t *func;
+
+	for (func = profile_functions[bucknum]; func; func = func->hash_next) {
+		if (func->addr == addr)
+			return func;
+	}
+
+	func = (profile_function_t *)glulx_malloc(sizeof(profile_function_t));
+	if (!func)
+		fatal_error("Profiler: cannot malloc function.");
+	memset(func, 0, sizeof(profile_function_t));
+	func->addr = addr;
+
+	func->hash_next = profile_functions[bucknum];
+	profile_functions[bucknum] = func;
+
+	return func;
+}
+
+void Glulx::profile_in(uint addr, uint stackuse, int accel) {
+	profile_function_t *func;
+	profile_frame_t *frame;
+	uint now;
+
+	if (!profiling_active)
+		return;
+
+	now = g_system->getMillis();
+
+	func = profile_get_function(addr);
+	func->call_count++;
+	if (accel)
+		func->accel_count++;
+	if (!func->entry_depth) {
+		func->entry_start_time = now;
+		func->entry_start_op = profile_opcount;
+	}
+	func->entry_depth++;
+	if (func->max_depth < func->entry_depth)
+		func->max_depth = func->entry_depth;
+	if (func->max_stack_use < stackuse)
+		func->max_stack_use = stackuse;
+
+	frame = (profile_frame_t *)glulx_malloc(sizeof(profile_frame_t));
+	if (!frame)
+		fatal_error("Profiler: cannot malloc frame.");
+	memset(frame, 0, sizeof(profile_frame_t));
+
+	frame->parent = profile_current_frame;
+	profile_current_frame = frame;
+
+	frame->func = func;
+	frame->entry_time = now;
+	frame->entry_op = profile_opcount;
+}
+
+void Glulx::profile_out(uint stackuse) {
+	profile_function_t *func;
+	profile_frame_t *frame;
+	uint now, runtime, runops;
+
+	if (!profiling_active)
+		return;
+
+	frame = profile_current_frame;
+	if (!frame)
+		fatal_error("Profiler: stack underflow.");
+
+	now = g_system->getMillis();
+	func = frame->func;
+
+	if (func->max_stack_use < stackuse)
+		func->max_stack_use = stackuse;
+
+	runtime = now - frame->entry_time;
+	runops = profile_opcount - frame->entry_op;
+
+	func->self_time += runtime - frame->children_time;
+	func->self_ops += runops - frame->children_ops;
+
+	if (!func->entry_depth)
+		fatal_error("Profiler: function entry underflow.");
+	func->entry_depth--;
+	if (!func->entry_depth) {
+		func->total_time += now - func->entry_start_time;
+		func->total_ops += profile_opcount - func->entry_start_op;
+		func->entry_start_time = 0;
+		func->entry_start_op = 0;
+	}
+
+	if (frame->parent) {
+		frame->parent->children_time += runtime;
+		frame->parent->children_ops += runops;
+	}
+
+	profile_current_frame = frame->parent;
+	glulx_free(frame);
+}
+
+void Glulx::profile_fail(const char *reason) {
+	if (!profiling_active)
+		return;
+
+	fatal_error_2("Profiler: unable to handle operation", reason);
+}
+
+void Glulx::profile_write_results() {
+	Common::DumpFile dumpFile;
+	Common::String line;
+	profile_function_t *func;
+	profile_function_t *hottest[PROFILE_SUMMARY_COUNT];
+	int bucknum, ix, hotcount = 0;
+
+	if (!profiling_stream) {
+		if (!dumpFile.open(profiling_filename ? profiling_filename : "profile-raw")) {
+			warning("Profiler: unable to open the profile output file");
+			return;
+		}
+	}
+
+	line = "<profile>\n  <function-list>\n";
+	if (profiling_stream)
+		glk_put_string_stream(profiling_stream, line.c_str());
+	else
+		dumpFile.writeString(line);
+
+	for (bucknum = 0; bucknum < PROFILE_HASH_SIZE; bucknum++) {
+		for (func = profile_functions[bucknum]; func; func = func->hash_next) {
+			line = Common::String::format("  <function addr=\"%u\" call_count=\"%u\" accel_count=\"%u\" "
+				"total_ops=\"%u\" total_time=\"%u.%03u\" self_ops=\"%u\" self_time=\"%u.%03u\" "
+				"max_depth=\"%u\" max_stack_use=\"%u\" />\n",
+				func->addr, func->call_count, func->accel_count,
+				func->total_ops, func->total_time / 1000, func->total_time % 1000,
+				func->self_ops, func->self_time / 1000, func->self_time % 1000,
+				func->max_depth, func->max_stack_use);
+			if (profiling_stream)
+				glk_put_string_stream(profiling_stream, line.c_str());
+			else
+				dumpFile.writeString(line);
+
+			// Keep the functions with the most own ops, for the summary below
+			for (ix = hotcount; ix > 0 && hottest[ix - 1]->self_ops < func->self_ops; ix--) {
+				if (ix < PROFILE_SUMMARY_COUNT)
+					hottest[ix] = hottest[ix - 1];
+			}
+			if (ix < PROFILE_SUMMARY_COUNT) {
+				hottest[ix] = func;
+				if (hotcount < PROFILE_SUMMARY_COUNT)
+					hotcount++;
+			}
+		}
+	}
+
+	line = "  </function-list>\n</profile>\n";
+	if (profiling_stream)
+		glk_put_string_stream(profiling_stream, line.c_str());
+	else
+		dumpFile.writeString(line);
+
+	debug("Glulx profile: %u opcodes executed; hottest functions by own opcodes:", profile_opcount);
+	for (ix = 0; ix < hotcount; ix++) {
+		func = hottest[ix];
+		debug("  %08x: %u ops in %u calls%s", func->addr, func->self_ops, func->call_count,
+			func->accel_count ? " (accelerated)" : "");
+	}
+}
+
+void Glulx::profile_quit() {
+	int bucknum;
+	profile_function_t *func;
+
+	if (!profiling_active)
+		return;
+
+	while (profile_current_frame)
+		profile_out(0);
+
+	if (profile_opcount)
+		profile_write_results();
+
+	for (bucknum = 0; bucknum < PROFILE_HASH_SIZE; bucknum++) {
+		while ((func = profile_functions[bucknum]) != nullptr) {
+			profile_functions[bucknum] = func->hash_next;
+			glulx_free(func);
+		}
+	}
+	glulx_free(profile_functions);
+	profile_functions = nullptr;
+
+	profiling_active = false;
+}
+
+} // End of namespace Glulx
+} // End of namespace Glk
+
+#endif /* VM_PROFILING */
@@ -186,6 +186,7 @@ MODULE_OBJS := \
 	glulx/glulx.o \
 	glulx/heap.o \
 	glulx/operand.o \
+	glulx/profile.o \
 	glulx/search.o \
 	glulx/serial.o \
 	glulx/string.o \
@@ -79,6 +79,20 @@ uint vochsh(const uchar *t, int len)
 	return(ret);
 }
 
+/*
+ *   compute lookup hash value - this mixes as it goes, so that anagrams
+ *   and similar words spread over the table
+ */
+uint vocfhsh(const uchar *t, int len)
+{
+	uint ret = 0;
+
+	if (len > 6) len = 6;
+	for ( ; len ; --len, ++t)
+		ret = ret * 31 + (uint)(vocisupper(*t) ? tolower(*t) : *t);
+	return((ret ^ (ret >> 10)) & (VOCFHSIZ - 1));
+}
+
 /* copy vocabulary word, and convert to lower case */
 static void voccpy(uchar *dst, const uchar *src, int len)
 {
@@ -211,15 +225,34 @@ static void vocwset(voccxdef *ctx, vocdef *v, prpnum p, objnum objn,
 	}
 }
 
-/* set up a vocdef record, and link into hash table */
+/* unlink a vocdef from its lookup hash chain */
+static void vocfunl(voccxdef *ctx, vocdef *v)
+{
+	vocdef **vp;
+
+	for (vp = &ctx->voccxfhs[vocfhsh(v->voctxt, v->voclen)] ; *vp ;
+		 vp = &(*vp)->vocfnx)
+	{
+		if (*vp == v)
+		{
+			*vp = v->vocfnx;
+			return;
+		}
+	}
+}
+
+/* set up a vocdef record, and link into hash tables */
 static void vocset(voccxdef *ctx, vocdef *v, prpnum p, objnum objn,
 				   int classflg, uchar *wrdtxt, int len,
 				   uchar *wrd2, int len2)
 {
 	uint hshval = vochsh(wrdtxt, len);
+	uint fhsval = vocfhsh(wrdtxt, len);
 
 	v->vocnxt = ctx->voccxhsh[hshval];
 	ctx->voccxhsh[hshval] = v;
+	v->vocfnx = ctx->voccxfhs[fhsval];
+	ctx->voccxfhs[fhsval] = v;
 
 	v->voclen = len;
 	v->vocln2 = len2;
@@ -244,8 +277,8 @@ void vocadd2(voccxdef *ctx, prpnum p, objnum objn, int classflg,
 		return;
 
 	/* look for a vocdef entry with the same word text */
-	hshval = vochsh(wrdtxt, len);
-	for (v = ctx->voccxhsh[hshval] ; v ; v = v->vocnxt)
+	hshval = vocfhsh(wrdtxt, len);
+	for (v = ctx->voccxfhs[hshval] ; v ; v = v->vocfnx)
 	{
 		/* if it matches on both words, use this entry */
 		if (v->voclen == len && !memcmp(wrdtxt, v->voctxt, (size_t)len)
@@ -788,6 +821,7 @@ void vocdel1(voccxdef *ctx, objnum objn, char *wrd1, prpnum prp,
 					{
 						if (prv) prv->vocnxt = v->vocnxt;
 						else *vp = v->vocnxt;
+						vocfunl(ctx, v);
 
 						/* link into free chain */
 						v->vocnxt = ctx->voccxfre;
@@ -71,6 +71,7 @@ struct vocwdef {
 /* vocabulary word structure */
 struct vocdef {
 	vocdef *vocnxt;                         /* next word at same hash value */
+	vocdef *vocfnx;                  /* next word at same lookup hash value */
 	uchar   voclen;                                   /* length of the word */
 	uchar   vocln2;          /* length of second word (0 if no second word) */
 	uint    vocwlst;      /* head of list of vocwdef's attached to the word */
@@ -113,9 +114,16 @@ struct vocidef {
 /* maximum number of inheritance pages (256 objects per page) */
 #define VOCINHMAX 128
 
-/* size of vocabulary hash table */
+/*
+ *   size of vocabulary hash table - the order of its chains is the order
+ *   in which voc_iterate visits words, which games can see through
+ *   getwords(), so it must stay as in the original runtime
+ */
 #define VOCHASHSIZ  256
 
+/* size of the larger table used to look words up (must be a power of two) */
+#define VOCFHSIZ  1024
+
 /* size of a template structure */
 #define VOCTPLSIZ 10
 
@@ -205,6 +213,7 @@ struct voccxdef {
 	char       voccxagainbuf[VOCBUFSIZ];
 
 	vocdef    *voccxhsh[VOCHASHSIZ];                          /* hash table */
+	vocdef    *voccxfhs[VOCFHSIZ];                     /* lookup hash table */
 
 #ifdef VOCW_IN_CACHE
 	mcmon      voccxwp[VOCWPGMAX];        /* list of pages of vocab records */
@@ -645,6 +654,9 @@ void vocdusave_me(voccxdef *ctx, objnum old_me);
 /* compute vocabulary word hash value */
 uint vochsh(const uchar *t, int len);
 
+/* compute vocabulary word lookup hash value */
+uint vocfhsh(const uchar *t, int len);
+
 /* TADS versions of isalpha, isspace, isdigit, etc */
 #define vocisupper(c) ((uchar)(c) <= 127 && Common::isUpper((uchar)(c)))
 #define vocislower(c) ((uchar)(c) <= 127 && Common::isLower((uchar)(c)))
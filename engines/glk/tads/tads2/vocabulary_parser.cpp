@@ -554,7 +554,7 @@ vocwdef *vocfnw(voccxdef *voccx, vocseadef *search_ctx)
 	vw = vocwget(voccx, search_ctx->vw->vocwnxt);
 
 	/* keep going until we run out of hash chain entries or find a match */
-	for (v = c, vf = 0 ; v != 0 && vf == 0 ; v = v->vocnxt, first = FALSE)
+	for (v = c, vf = 0 ; v != 0 && vf == 0 ; v = v->vocfnx, first = FALSE)
 	{
 		/* if this word matches, look at the objects in its list */
 		if (first
@@ -607,11 +607,11 @@ vocwdef *vocffw(voccxdef *ctx, const char *wrd, int len, const char *wrd2, int l
 	vocwdef *vw, *vwf = nullptr;
 
 	/* get the word's hash value */
-	hshval = vochsh((const uchar *)wrd, len);
+	hshval = vocfhsh((const uchar *)wrd, len);
 
 	/* scan the hash list until we run out of entries, or find a match */
-	for (v = ctx->voccxhsh[hshval], vf = 0 ; v != 0 && vf == 0 ;
-		 v = v->vocnxt)
+	for (v = ctx->voccxfhs[hshval], vf = 0 ; v != 0 && vf == 0 ;
+		 v = v->vocfnx)
 	{
 		/* if this word matches, look at the objects in its list */
 		if (voceq((const uchar *)wrd, len, v->voctxt, v->voclen)
@@ -1500,8 +1500,8 @@ static int voc_lookup_type(voccxdef *ctx, char *p, int len, int of_is_spec)
 		 *   verbs; the second word is considered later during the
 		 *   semantic analysis.
 		 */
-		for (t = 0, v = ctx->voccxhsh[vochsh((uchar *)p, len)] ; v != 0 ;
-			 v = v->vocnxt)
+		for (t = 0, v = ctx->voccxfhs[vocfhsh((uchar *)p, len)] ; v != 0 ;
+			 v = v->vocfnx)
 		{
 			/* if this hash chain entry matches, add it to our types */
 			if (voceq((uchar *)p, len, v->voctxt, v->voclen))
@@ -130,14 +130,22 @@ void TextBufferWindow::reflow() {
 		return;
 
 	_lines[0]._len = _numChars;
+	s = _scrollMax < SCROLLBACK ? _scrollMax : SCROLLBACK - 1;
+
+	// size the temp buffers to the text actually present, rather than the whole scrollback
+	int numChars = 0, numPics = 0;
+	for (k = s; k >= 0; k--) {
+		numChars += _lines[k]._len + (_lines[k]._newLine ? 1 : 0);
+		numPics += (_lines[k]._lPic ? 1 : 0) + (_lines[k]._rPic ? 1 : 0);
+	}
 
 	// allocate temp buffers
-	Attributes *attrbuf = new Attributes[SCROLLBACK * TBLINELEN];
-	uint32 *charbuf = new uint32[SCROLLBACK * TBLINELEN];
-	int *alignbuf = new int[SCROLLBACK];
-	Picture **pictbuf = new Picture *[SCROLLBACK];
-	uint *hyperbuf = new uint[SCROLLBACK];
-	int *offsetbuf = new int[SCROLLBACK];
+	Attributes *attrbuf = new Attributes[numChars + 1];
+	uint32 *charbuf = new uint32[numChars + 1];
+	int *alignbuf = new int[numPics + 1];
+	Picture **pictbuf = new Picture *[numPics + 1];
+	uint *hyperbuf = new uint[numPics + 1];
+	int *offsetbuf = new int[numPics + 1];
 
 	if (!attrbuf || !charbuf || !alignbuf || !pictbuf || !hyperbuf || !offsetbuf) {
 		delete[] attrbuf;
@@ -156,7 +164,6 @@ void TextBufferWindow::reflow() {
 
 	x = 0;
 	p = 0;
-	s = _scrollMax < SCROLLBACK ? _scrollMax : SCROLLBACK - 1;
 
 	for (k = s; k >= 0; k--) {
 		if (k == 0 && _lineRequest)
@@ -857,14 +864,12 @@ void TextBufferWindow::redraw() {
 		if (selrow)
 			_lines[i]._dirty = true;
 
-		TextBufferRow ln(_lines[i]);
-
 		// skip if we can
-		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw && _scrollPos == 0)
+		if (!_lines[i]._dirty && !_lines[i]._repaint && !Windows::_forceRedraw && _scrollPos == 0)
 			continue;
 
 		// repaint previously selected lines if needed
-		if (ln._repaint && !Windows::_forceRedraw)
+		if (_lines[i]._repaint && !Windows::_forceRedraw)
 			_windows->redrawRect(Rect(x0 / GLI_SUBPIX, y,
 									  x1 / GLI_SUBPIX, y + _font._leading));
 
@@ -880,6 +885,9 @@ void TextBufferWindow::redraw() {
 		if (i == _scrollPos && i > 0)
 			continue;
 
+		// work on a copy, since highlighting the selection alters the attributes
+		TextBufferRow ln(_lines[i]);
+
 		linelen = ln._len;
 
 		// kill spaces at the end unless they're a different color
@@ -1088,7 +1096,10 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
+
+		if (!ln._lPic && !ln._rPic)
+			continue;
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
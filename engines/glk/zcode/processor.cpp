@@ -200,7 +200,7 @@ void Processor::initialize() {
 	}
 }
 
-void Processor::load_operand(zbyte type) {
+inline zword Processor::fetch_operand(zbyte type) {
 	zword value;
 
 	if (type & 2) {
@@ -229,7 +229,11 @@ void Processor::load_operand(zbyte type) {
 		CODE_WORD(value);
 	}
 
-	zargs[zargc++] = value;
+	return value;
+}
+
+void Processor::load_operand(zbyte type) {
+	zargs[zargc++] = fetch_operand(type);
 }
 
 void Processor::load_all_operands(zbyte specifier) {
@@ -244,26 +248,32 @@ void Processor::load_all_operands(zbyte specifier) {
 }
 
 void Processor::interpret() {
+	// Checking for a quit request goes through the event manager, which is
+	// too costly to do for every instruction
+	uint quitCheckCount = 0;
+
 	do {
 		zbyte opcode;
 		CODE_BYTE(opcode);
-		zargc = 0;
 
 		if (opcode < 0x80) {
 			// 2OP opcodes
-			load_operand((zbyte)(opcode & 0x40) ? 2 : 1);
-			load_operand((zbyte)(opcode & 0x20) ? 2 : 1);
+			zargs[0] = fetch_operand((opcode & 0x40) ? 2 : 1);
+			zargs[1] = fetch_operand((opcode & 0x20) ? 2 : 1);
+			zargc = 2;
 
 			(*this.*var_opcodes[opcode & 0x1f])();
 
 		} else if (opcode < 0xb0) {
 			// 1OP opcodes
-			load_operand((zbyte)(opcode >> 4));
+			zargs[0] = fetch_operand(opcode >> 4);
+			zargc = 1;
 
 			(*this.*op1_opcodes[opcode & 0x0f])();
 
 		} else if (opcode < 0xc0) {
 			// 0OP opcodes
+			zargc = 0;
 			(*this.*op0_opcodes[opcode - 0xb0])();
 
 
@@ -272,6 +282,8 @@ void Processor::interpret() {
 			zbyte specifier1;
 			zbyte specifier2;
 
+			zargc = 0;
+
 			if (opcode == 0xec || opcode == 0xfa) {	// opcodes 0xec
 				CODE_BYTE(specifier1);			// and 0xfa are
 				CODE_BYTE(specifier2);          // call opcodes
@@ -289,7 +301,7 @@ void Processor::interpret() {
 		if (end_of_sound_flag)
 			end_of_sound();
 #endif
-	} while (!shouldQuit() && !_finished);
+	} while (!_finished && ((++quitCheckCount & 0xff) || !shouldQuit()));
 
 	_finished--;
 }
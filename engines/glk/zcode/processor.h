@@ -101,6 +101,11 @@ protected:
 	 * @{
 	 */
 
+	/**
+	 * Read an operand, either a variable or a constant, and return its value.
+	 */
+	inline zword fetch_operand(zbyte type);
+
 	/**
 	 * Load an operand, either a variable or a constant.
 	 */
@@ -54,6 +54,7 @@
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
 #include "common/memstream.h"
+#include "sci/graphics/celobj32.h"
 #include "sci/graphics/frameout.h"
 #include "sci/graphics/paint32.h"
 #include "sci/graphics/palette32.h"
@@ -120,6 +121,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
 	registerCmd("verify_scripts",		WRAP_METHOD(Console, cmdVerifyScripts));
 	registerCmd("integrity_dump",	WRAP_METHOD(Console, cmdResourceIntegrityDump));
+	registerCmd("resource_stats",		WRAP_METHOD(Console, cmdResourceStats));
 	// Game
 	registerCmd("save_game",			WRAP_METHOD(Console, cmdSaveGame));
 	registerCmd("restore_game",		WRAP_METHOD(Console, cmdRestoreGame));
@@ -150,6 +152,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
+	registerCmd("cel_cache",          WRAP_METHOD(Console, cmdCelCache));
 	// Segments
 	registerCmd("segment_table",		WRAP_METHOD(Console, cmdPrintSegmentTable));
 	registerCmd("segtable",			WRAP_METHOD(Console, cmdPrintSegmentTable));	// alias
@@ -163,6 +166,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -350,6 +354,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
 	debugPrintf(" verify_scripts - Performs sanity checks on SCI1.1-SCI2.1 game scripts (e.g. if they're up to 64KB in total)\n");
 	debugPrintf(" integrity_dump - Dumps integrity data about resources in the current game to disk\n");
+	debugPrintf(" resource_stats - Shows or resets resource loading and prefetching statistics\n");
 	debugPrintf("\n");
 	debugPrintf("Game:\n");
 	debugPrintf(" save_game - Saves the current game state to the hard disk\n");
@@ -376,6 +381,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
+	debugPrintf(" cel_cache - Shows or resets decompressed cel cache statistics (SCI2+)\n");
 	debugPrintf("\n");
 	debugPrintf("Segments:\n");
 	debugPrintf(" segment_table / segtable - Lists all segments\n");
@@ -388,6 +394,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows or resets garbage collector pause and throughput statistics\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -1107,6 +1114,33 @@ bool Console::cmdResourceTypes(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdResourceStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Shows per resource type loading statistics\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		_engine->getResMan()->resetLoadStatistics();
+		debugPrintf("Resource statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("%-10s %8s %8s %10s %8s %10s %8s\n", "Type", "Hits", "Loads", "Time (ms)", "Max", "Prefetched", "Used");
+	for (int i = 0; i < kResourceTypeInvalid; i++) {
+		const ResourceManager::LoadStatistics &stats = _engine->getResMan()->getLoadStatistics((ResourceType)i);
+		if (!stats.hits && !stats.loads && !stats.prefetched)
+			continue;
+
+		debugPrintf("%-10s %8u %8u %10u %8u %10u %8u\n", getResourceTypeName((ResourceType)i),
+		            stats.hits, stats.loads, stats.loadTime, stats.maxLoadTime,
+		            stats.prefetched, stats.prefetchHits);
+	}
+
+	return true;
+}
+
 bool Console::cmdHexgrep(int argc, const char **argv) {
 	if (argc < 4) {
 		debugPrintf("Searches some resources for a particular sequence of bytes, represented as decimal or hexadecimal numbers.\n");
@@ -2192,6 +2226,43 @@ bool Console::cmdSavedBits(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdCelCache(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") && strcmp(argv[1], "clear"))) {
+		debugPrintf("Shows statistics of the decompressed cel cache\n");
+		debugPrintf("Usage: %s [reset | clear]\n", argv[0]);
+		debugPrintf("reset: Resets the hit, miss and eviction counters\n");
+		debugPrintf("clear: Discards all cached cels\n");
+		debugPrintf("The cache budget is set in KiB with the sci_cel_cache_size config key\n");
+		return true;
+	}
+
+#ifdef ENABLE_SCI32
+	if (!_engine->_gfxFrameout) {
+		debugPrintf("This SCI version does not use the cel cache\n");
+		return true;
+	}
+
+	CelPixelCache *cache = CelObj::_pixelCache.get();
+	if (!cache) {
+		debugPrintf("The cel cache is disabled\n");
+		return true;
+	}
+
+	if (argc == 2) {
+		if (!strcmp(argv[1], "reset")) {
+			cache->resetStats();
+		} else {
+			cache->clear();
+		}
+	}
+
+	cache->printStats(this);
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdShowSavedBits(int argc, const char **argv) {
 	if (argc < 2) {
 		debugPrintf("Display saved bits.\n");
@@ -2733,6 +2804,28 @@ bool Console::cmdGCInvoke(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	GCStatistics &stats = _engine->_gamestate->gcStats;
+
+	if (argc == 2 && !strcmp(argv[1], "reset")) {
+		stats.reset();
+		debugPrintf("Garbage collector statistics reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Shows garbage collector statistics\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	debugPrintf("Collections: %u, skipped: %u\n", stats.runs, stats.skippedRuns);
+	debugPrintf("Pause time: total %u ms, max %u ms, last %u ms, average %u ms\n",
+				stats.totalTime, stats.maxTime, stats.lastTime, stats.runs ? stats.totalTime / stats.runs : 0);
+	debugPrintf("Freed: total %u, last run %u\n", stats.totalFreed, stats.lastFreed);
+	debugPrintf("Last run: %u reachable addresses, %u allocations since the previous run\n", stats.lastReachable, stats.lastAllocations);
+	debugPrintf("Allocations since last run: %u\n", _engine->_gamestate->_segMan->getAllocationsSinceGC());
+	return true;
+}
+
 bool Console::cmdGCObjects(int argc, const char **argv) {
 	AddrSet *use_map = findAllActiveReferences(_engine->_gamestate);
 
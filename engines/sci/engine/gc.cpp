@@ -22,6 +22,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -181,6 +182,9 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 
 void run_gc(EngineState *s) {
 	SegManager *segMan = s->_segMan;
+	GCStatistics &stats = s->gcStats;
+	const uint32 startTime = g_system->getMillis();
+	uint32 freed = 0;
 
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
@@ -214,6 +218,7 @@ void run_gc(EngineState *s) {
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					++freed;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -224,8 +229,19 @@ void run_gc(EngineState *s) {
 		}
 	}
 
+	stats.lastReachable = activeRefs->size();
 	delete activeRefs;
 
+	stats.lastAllocations = segMan->getAllocationsSinceGC();
+	segMan->resetAllocationsSinceGC();
+
+	stats.lastTime = g_system->getMillis() - startTime;
+	stats.totalTime += stats.lastTime;
+	stats.maxTime = MAX(stats.maxTime, stats.lastTime);
+	stats.lastFreed = freed;
+	stats.totalFreed += freed;
+	++stats.runs;
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -235,4 +251,13 @@ void run_gc(EngineState *s) {
 #endif
 }
 
+void run_periodic_gc(EngineState *s) {
+	if (s->_segMan->getAllocationsSinceGC()) {
+		run_gc(s);
+	} else {
+		debugC(kDebugLevelGC, "[GC] Nothing allocated since last run, skipping");
+		++s->gcStats.skippedRuns;
+	}
+}
+
 } // End of namespace Sci
@@ -55,6 +55,16 @@ AddrSet *findAllActiveReferences(EngineState *s);
  */
 void run_gc(EngineState *s);
 
+/**
+ * Runs garbage collection on the current system state, unless nothing
+ * collectable has been allocated or released since the last collection.
+ * Garbage which has appeared since then without any new allocations does
+ * not increase memory use, so reclaiming it can wait until the next
+ * allocation.
+ * @param s The state in which we should gc
+ */
+void run_periodic_gc(EngineState *s);
+
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
 	AddrSet _map;	// used for 2 contains() calls, inside push() and run_gc()
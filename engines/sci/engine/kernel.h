@@ -269,6 +269,12 @@ private:
 	const Common::String _invalid;
 };
 
+/**
+ * Frees the paths memoized by kAvoidPath. Called when the game state is
+ * reset or destroyed, so cached paths don't outlive the game.
+ */
+void clearAvoidPathCache();
+
 /******************** Kernel functions ********************/
 
 reg_t kStrLen(EngineState *s, int argc, reg_t *argv);
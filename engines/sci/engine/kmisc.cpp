@@ -218,6 +218,10 @@ reg_t kMemorySegment(EngineState *s, int argc, reg_t *argv) {
 reg_t kFlushResources(EngineState *s, int argc, reg_t *argv) {
 	run_gc(s);
 	debugC(kDebugLevelRoom, "Entering room number %d", argv[0].toUint16());
+
+	// In SCI32 this is called as Purge, whose parameter is not a room number
+	if (getSciVersion() <= SCI_VERSION_1_1)
+		g_sci->getResMan()->prefetchRoom(argv[0].toUint16());
 	return s->r_acc;
 }
 
@@ -38,6 +38,7 @@
 #include "common/list.h"
 #include "common/system.h"
 #include "common/math.h"
+#include "common/ptr.h"
 
 //#define DEBUG_MERGEPOLY
 
@@ -117,13 +118,39 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// Position of this vertex in the vertex index
+	int index;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		index = -1;
+	}
+};
+
+// Inclusive bounding box of a line segment
+struct SegmentBounds {
+	int16 left, top, right, bottom;
+
+	SegmentBounds() : left(0), top(0), right(0), bottom(0) {}
+	SegmentBounds(const Common::Point &a, const Common::Point &b) :
+		left(MIN(a.x, b.x)), top(MIN(a.y, b.y)),
+		right(MAX(a.x, b.x)), bottom(MAX(a.y, b.y)) {}
+
+	bool intersects(const SegmentBounds &other) const {
+		return left <= other.right && other.left <= right &&
+			top <= other.bottom && other.top <= bottom;
 	}
 };
 
+// Results of visibility tests between two vertices
+enum {
+	VIS_UNKNOWN = 0,
+	VIS_VISIBLE = 1,
+	VIS_HIDDEN = 2
+};
+
 class VertexList: public Common::List<Vertex *> {
 public:
 	bool contains(Vertex *v) {
@@ -253,6 +280,16 @@ struct PathfindingState {
 	// Array of all vertices, used for sorting
 	Vertex **vertex_index;
 
+	// Bounding boxes of the edges starting at each vertex in vertex_index.
+	// An edge can only block the line between two vertices if its bounding
+	// box overlaps the bounding box of that line.
+	SegmentBounds *edge_bounds;
+
+	// Matrix of visibility test results between each pair of vertices in
+	// vertex_index. Visibility is symmetric, so each pair only needs to be
+	// tested once.
+	byte *visibility;
+
 	// Total number of vertices
 	int vertices;
 
@@ -267,6 +304,8 @@ struct PathfindingState {
 		vertex_start = NULL;
 		vertex_end = NULL;
 		vertex_index = NULL;
+		edge_bounds = NULL;
+		visibility = NULL;
 		_prependPoint = NULL;
 		_appendPoint = NULL;
 		vertices = 0;
@@ -274,6 +313,8 @@ struct PathfindingState {
 
 	~PathfindingState() {
 		free(vertex_index);
+		free(edge_bounds);
+		free(visibility);
 
 		delete _prependPoint;
 		delete _appendPoint;
@@ -699,6 +740,47 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+/**
+ * Determines whether or not two vertices can see each other, i.e. whether the
+ * line between them intersects no polygon.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the first vertex
+ * @param vertex		the second vertex
+ * @return true if the vertices are visible from each other, false otherwise
+ */
+static bool is_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	const SegmentBounds bounds(vertex_cur->v, vertex->v);
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			// An edge outside of the bounding box of the line can neither
+			// touch nor properly intersect it
+			if (!bounds.intersects(s->edge_bounds[j]))
+				continue;
+
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
@@ -707,34 +789,17 @@ static int inside(const Common::Point &p, Vertex *vertex) {
  */
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
+	byte *visibility = s->visibility + vertex_cur->index * s->vertices;
 
 	for (int i = 0; i < s->vertices; i++) {
 		Vertex *vertex = s->vertex_index[i];
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
-			continue;
-
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
-
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
-			}
+		if (visibility[i] == VIS_UNKNOWN) {
+			visibility[i] = is_visible(s, vertex_cur, vertex) ? VIS_VISIBLE : VIS_HIDDEN;
+			s->visibility[i * s->vertices + vertex_cur->index] = visibility[i];
 		}
 
-		if (j == s->vertices)
+		if (visibility[i] == VIS_VISIBLE)
 			visVerts->push_front(vertex);
 	}
 
@@ -1232,20 +1297,17 @@ static void change_polygons_opt_0(PathfindingState *s) {
 }
 
 /**
- * Converts the SCI input data for pathfinding
+ * Converts the polygons of an SCI polygon list and adds them to the
+ * pathfinding state
  * Parameters: (EngineState *) s: The game state
  *             (reg_t) poly_list: Polygon list
- *             (Common::Point) start: The start point
- *             (Common::Point) end: The end point
- *             (int) opt: Optimization level (0, 1 or 2)
- * Returns   : (PathfindingState *) On success a newly allocated pathfinding state,
- *                            NULL otherwise
+ *             (PathfindingState *) pf_s: The pathfinding state
+ * Returns   : (int) The total number of vertices of the converted polygons
  */
-static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Common::Point start, Common::Point end, int width, int height, int opt) {
+static int convert_polygon_list(EngineState *s, reg_t poly_list, PathfindingState *pf_s) {
 	SegManager *segMan = s->_segMan;
 	Polygon *polygon;
 	int count = 0;
-	PathfindingState *pf_s = new PathfindingState(width, height);
 
 	// Convert all polygons
 	if (poly_list.getSegment()) {
@@ -1266,6 +1328,24 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		}
 	}
 
+	return count;
+}
+
+/**
+ * Prepares the converted SCI input data for pathfinding
+ * Parameters: (EngineState *) s: The game state
+ *             (PathfindingState *) pf_s: The pathfinding state, holding the
+ *                                        polygons from convert_polygon_list
+ *             (int) count: The total number of vertices of the polygons
+ *             (Common::Point) start: The start point
+ *             (Common::Point) end: The end point
+ *             (int) opt: Optimization level (0, 1 or 2)
+ * Returns   : (PathfindingState *) On success the pathfinding state,
+ *                            NULL otherwise, in which case pf_s is deleted
+ */
+static PathfindingState *convert_polygon_set(EngineState *s, PathfindingState *pf_s, int count, Common::Point start, Common::Point end, int opt) {
+	Polygon *polygon;
+
 	if (opt == 0)
 		change_polygons_opt_0(pf_s);
 
@@ -1339,12 +1419,22 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		Vertex *vertex;
 
 		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->index = count;
 			pf_s->vertex_index[count++] = vertex;
 		}
 	}
 
 	pf_s->vertices = count;
 
+	// Build edge bounding boxes and an empty visibility matrix
+	pf_s->edge_bounds = (SegmentBounds *)malloc(sizeof(SegmentBounds) * count);
+	for (int i = 0; i < count; i++) {
+		const Vertex *vertex = pf_s->vertex_index[i];
+		pf_s->edge_bounds[i] = SegmentBounds(vertex->v, CLIST_NEXT(vertex)->v);
+	}
+
+	pf_s->visibility = (byte *)calloc(count * count, 1);
+
 	return pf_s;
 }
 
@@ -1465,14 +1555,25 @@ static reg_t allocateOutputArray(SegManager *segMan, int size) {
 }
 
 /**
- * Stores the final path in newly allocated dynmem
+ * A computed kAvoidPath result, as it is written to the output array
+ */
+struct AvoidPathResult {
+	// The points of the path, including the terminating sentinel
+	Common::Array<Common::Point> points;
+
+	// The number of points allocated for the output array
+	int size;
+
+	AvoidPathResult() : size(0) {}
+};
+
+/**
+ * Collects the final path from the pathfinding state
  * Parameters: (PathfindingState *) p: The pathfinding state
- *             (EngineState *) s: The game state
- * Returns   : (reg_t) Pointer to dynmem containing path
+ *             (AvoidPathResult &) result: Receives the path
  */
-static reg_t output_path(PathfindingState *p, EngineState *s) {
+static void build_path(PathfindingState *p, AvoidPathResult &result) {
 	int path_len = 0;
-	reg_t output;
 	Vertex *vertex = p->vertex_end;
 	int unreachable = vertex->path_prev == NULL;
 
@@ -1485,43 +1586,55 @@ static reg_t output_path(PathfindingState *p, EngineState *s) {
 	}
 
 	// Allocate memory for path, plus 3 extra for appended point, prepended point and sentinel
-	output = allocateOutputArray(s->_segMan, path_len + 3);
-	SegmentRef arrayRef = s->_segMan->dereference(output);
-	assert(arrayRef.isValid() && !arrayRef.skipByte);
+	result.size = path_len + 3;
+	result.points.clear();
 
 	if (unreachable) {
 		// If pathfinding failed we only return the path up to vertex_start
 
 		if (p->_prependPoint)
-			writePoint(arrayRef, 0, *p->_prependPoint);
+			result.points.push_back(*p->_prependPoint);
 		else
-			writePoint(arrayRef, 0, p->vertex_start->v);
+			result.points.push_back(p->vertex_start->v);
 
-		writePoint(arrayRef, 1, p->vertex_start->v);
-		writePoint(arrayRef, 2, Common::Point(POLY_LAST_POINT, POLY_LAST_POINT));
+		result.points.push_back(p->vertex_start->v);
+		result.points.push_back(Common::Point(POLY_LAST_POINT, POLY_LAST_POINT));
 
-		return output;
+		return;
 	}
 
-	int offset = 0;
+	if (p->_prependPoint)
+		result.points.push_back(*p->_prependPoint);
 
-	if (p->_prependPoint) {
-		writePoint(arrayRef, offset, *p->_prependPoint);
-		offset++;
-	}
+	const uint offset = result.points.size();
+	result.points.resize(offset + path_len);
 
 	vertex = p->vertex_end;
 	for (int i = path_len - 1; i >= 0; i--) {
-		writePoint(arrayRef, offset + i, vertex->v);
+		result.points[offset + i] = vertex->v;
 		vertex = vertex->path_prev;
 	}
-	offset += path_len;
 
 	if (p->_appendPoint)
-		writePoint(arrayRef, offset++, *p->_appendPoint);
+		result.points.push_back(*p->_appendPoint);
 
 	// Sentinel
-	writePoint(arrayRef, offset, Common::Point(POLY_LAST_POINT, POLY_LAST_POINT));
+	result.points.push_back(Common::Point(POLY_LAST_POINT, POLY_LAST_POINT));
+}
+
+/**
+ * Stores the final path in newly allocated dynmem
+ * Parameters: (const AvoidPathResult &) result: The path
+ *             (EngineState *) s: The game state
+ * Returns   : (reg_t) Pointer to dynmem containing path
+ */
+static reg_t output_path(const AvoidPathResult &result, EngineState *s) {
+	reg_t output = allocateOutputArray(s->_segMan, result.size);
+	SegmentRef arrayRef = s->_segMan->dereference(output);
+	assert(arrayRef.isValid() && !arrayRef.skipByte);
+
+	for (uint i = 0; i < result.points.size(); i++)
+		writePoint(arrayRef, i, result.points[i]);
 
 	if (DebugMan.isDebugChannelEnabled(kDebugLevelAvoidPath)) {
 		debug("\nReturning path:");
@@ -1532,7 +1645,7 @@ static reg_t output_path(PathfindingState *p, EngineState *s) {
 			return output;
 		}
 
-		for (int i = 0; i < offset; i++) {
+		for (uint i = 0; i + 1 < result.points.size(); i++) {
 			Common::Point pt = readPoint(outputList, i);
 			debugN(-1, " (%i, %i)", pt.x, pt.y);
 		}
@@ -1542,6 +1655,102 @@ static reg_t output_path(PathfindingState *p, EngineState *s) {
 	return output;
 }
 
+/**
+ * A memoized kAvoidPath query. Pathfinding is deterministic, so repeating a
+ * query with the same polygons, start and end points, screen size and
+ * optimization level in the same room yields the same path.
+ */
+struct AvoidPathCacheEntry {
+	uint32 hash;
+	Common::Array<int16> key;
+	AvoidPathResult result;
+};
+
+typedef Common::List<AvoidPathCacheEntry> AvoidPathCache;
+
+enum {
+	kAvoidPathCacheSize = 16
+};
+
+// Most recently used entries are kept at the front
+static Common::ScopedPtr<AvoidPathCache> s_avoidPathCache;
+
+void clearAvoidPathCache() {
+	s_avoidPathCache.reset();
+}
+
+/**
+ * Builds the key identifying a kAvoidPath query in the path cache
+ * Parameters: (EngineState *) s: The game state
+ *             (PathfindingState *) p: The pathfinding state, holding the converted polygons
+ *             (Common::Point) start, end: The start and end points
+ *             (int) opt: Optimization level
+ *             (Common::Array<int16> &) key: Receives the key
+ * Returns   : (uint32) A hash of the key
+ */
+static uint32 make_path_key(EngineState *s, PathfindingState *p, const Common::Point &start, const Common::Point &end, int opt, Common::Array<int16> &key) {
+	key.clear();
+	key.push_back(g_sci->getGameId());
+	key.push_back(s->currentRoomNumber());
+	key.push_back(p->_width);
+	key.push_back(p->_height);
+	key.push_back(opt);
+	key.push_back(start.x);
+	key.push_back(start.y);
+	key.push_back(end.x);
+	key.push_back(end.y);
+
+	for (PolygonList::iterator it = p->polygons.begin(); it != p->polygons.end(); ++it) {
+		Polygon *polygon = *it;
+		Vertex *vertex;
+
+		key.push_back(polygon->type);
+		key.push_back(polygon->vertices.size());
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			key.push_back(vertex->v.x);
+			key.push_back(vertex->v.y);
+		}
+	}
+
+	uint32 hash = 0;
+	for (uint i = 0; i < key.size(); i++)
+		hash = hash * 31 + (uint16)key[i];
+
+	return hash;
+}
+
+static const AvoidPathResult *find_cached_path(uint32 hash, const Common::Array<int16> &key) {
+	if (!s_avoidPathCache)
+		return NULL;
+
+	for (AvoidPathCache::iterator it = s_avoidPathCache->begin(); it != s_avoidPathCache->end(); ++it) {
+		if (it->hash == hash && it->key == key) {
+			// Move to front
+			if (it != s_avoidPathCache->begin()) {
+				s_avoidPathCache->push_front(*it);
+				s_avoidPathCache->erase(it);
+			}
+			return &s_avoidPathCache->front().result;
+		}
+	}
+
+	return NULL;
+}
+
+static void cache_path(uint32 hash, const Common::Array<int16> &key, const AvoidPathResult &result) {
+	if (!s_avoidPathCache)
+		s_avoidPathCache.reset(new AvoidPathCache());
+
+	if (s_avoidPathCache->size() >= kAvoidPathCacheSize)
+		s_avoidPathCache->pop_back();
+
+	s_avoidPathCache->push_front(AvoidPathCacheEntry());
+	AvoidPathCacheEntry &entry = s_avoidPathCache->front();
+	entry.hash = hash;
+	entry.key = key;
+	entry.result = result;
+}
+
 reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 	Common::Point start = Common::Point(argv[0].toSint16(), argv[1].toSint16());
 
@@ -1607,7 +1816,25 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 			}
 		}
 
-		PathfindingState *p = convert_polygon_set(s, poly_list, start, end, width, height, opt);
+		PathfindingState *p = new PathfindingState(width, height);
+		const int count = convert_polygon_list(s, poly_list, p);
+
+		// Scripts tend to repeat the same query every cycle while an actor
+		// is moving, so reuse the previous result for identical input. The
+		// debug channel always recomputes so that the full output is shown.
+		Common::Array<int16> key;
+		uint32 hash = 0;
+		const bool useCache = !DebugMan.isDebugChannelEnabled(kDebugLevelAvoidPath);
+		if (useCache) {
+			hash = make_path_key(s, p, start, end, opt, key);
+			const AvoidPathResult *cached = find_cached_path(hash, key);
+			if (cached) {
+				delete p;
+				return output_path(*cached, s);
+			}
+		}
+
+		p = convert_polygon_set(s, p, count, start, end, opt);
 
 		if (!p) {
 			warning("[avoidpath] Error: pathfinding failed for following input:\n");
@@ -1627,9 +1854,15 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 		// Apply Dijkstra
 		AStar(p);
 
-		output = output_path(p, s);
+		AvoidPathResult result;
+		build_path(p, result);
 		delete p;
 
+		if (useCache)
+			cache_path(hash, key, result);
+
+		output = output_path(result, s);
+
 		// Memory is freed by explicit calls to Memory
 		return output;
 	}
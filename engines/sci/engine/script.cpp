@@ -28,6 +28,7 @@
 #include "sci/engine/state.h"
 #include "sci/engine/kernel.h"
 #include "sci/engine/script.h"
+#include "sci/engine/vm.h"
 
 #include "common/util.h"
 
@@ -73,6 +74,37 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_offsetLookupObjectCount = 0;
 	_offsetLookupStringCount = 0;
 	_offsetLookupSaidCount = 0;
+
+	_decodedInstructionIndex.clear();
+	_decodedInstructions.clear();
+}
+
+uint32 Script::decodeInstruction(uint32 offset, byte &extOpcode, int16 opparams[4]) {
+	if (_decodedInstructionIndex.empty())
+		_decodedInstructionIndex.resize(_buf->size());
+
+	const uint16 index = _decodedInstructionIndex[offset];
+	if (index) {
+		const DecodedInstruction &instruction = _decodedInstructions[index - 1];
+		extOpcode = instruction.extOpcode;
+		memcpy(opparams, instruction.params, sizeof(instruction.params));
+		return instruction.size;
+	}
+
+	const uint32 size = readPMachineInstruction(getBuf(offset), extOpcode, opparams);
+
+	// The index is 16 bits wide; once it is exhausted, further instructions
+	// are simply decoded every time
+	if (_decodedInstructions.size() < 0xFFFF) {
+		DecodedInstruction instruction;
+		instruction.size = size;
+		instruction.extOpcode = extOpcode;
+		memcpy(instruction.params, opparams, sizeof(instruction.params));
+		_decodedInstructions.push_back(instruction);
+		_decodedInstructionIndex[offset] = _decodedInstructions.size();
+	}
+
+	return size;
 }
 
 enum {
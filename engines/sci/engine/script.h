@@ -94,6 +94,24 @@ private:
 
 	ObjMap _objects;	/**< Table for objects, contains property variables */
 
+	/**
+	 * A bytecode instruction as decoded by readPMachineInstruction.
+	 */
+	struct DecodedInstruction {
+		uint16 size;
+		byte extOpcode;
+		int16 params[4];
+	};
+
+	/**
+	 * Instructions decoded so far by run_vm, so that each instruction is
+	 * only decoded once per load of the script. _decodedInstructionIndex maps
+	 * each buffer offset to 1 + the position of its instruction in
+	 * _decodedInstructions, or 0 if it has not been decoded yet.
+	 */
+	Common::Array<uint16> _decodedInstructionIndex;
+	Common::Array<DecodedInstruction> _decodedInstructions;
+
 protected:
 	offsetLookupArrayType _offsetLookupArray; // Table of all elements of currently loaded script, that may get pointed to
 
@@ -128,6 +146,14 @@ public:
 	const ObjMap &getObjectMap() const { return _objects; }
 	bool offsetIsObject(uint32 offset) const;
 
+	/**
+	 * Decodes the bytecode instruction at the given offset of the script
+	 * buffer, like readPMachineInstruction, reusing the result of earlier
+	 * calls for the same offset.
+	 * @return the size of the instruction in bytes
+	 */
+	uint32 decodeInstruction(uint32 offset, byte &extOpcode, int16 opparams[4]);
+
 public:
 	Script();
 	~Script() override;
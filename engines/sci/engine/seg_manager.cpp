@@ -43,6 +43,8 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_saveDirPtr = NULL_REG;
 	_parserPtr = NULL_REG;
 
+	_allocationsSinceGC = 0;
+
 #ifdef ENABLE_SCI32
 	_arraysSegId = 0;
 	_bitmapSegId = 0;
@@ -72,6 +74,10 @@ void SegManager::resetSegMan() {
 	_nodesSegId = 0;
 	_hunksSegId = 0;
 
+	// The heap may be repopulated from a saved game without going through
+	// the allocators, so make sure that the next collection is not skipped
+	_allocationsSinceGC = 1;
+
 #ifdef ENABLE_SCI32
 	_arraysSegId = 0;
 	_bitmapSegId = 0;
@@ -454,6 +460,7 @@ reg_t SegManager::allocateHunkEntry(const char *hunk_type, int size) {
 	table = (HunkTable *)_heap[_hunksSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	reg_t addr = make_reg(_hunksSegId, offset);
 	Hunk *h = &table->at(offset);
@@ -489,6 +496,7 @@ Clone *SegManager::allocateClone(reg_t *addr) {
 		table = (CloneTable *)_heap[_clonesSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_clonesSegId, offset);
 	return &table->at(offset);
@@ -503,6 +511,7 @@ List *SegManager::allocateList(reg_t *addr) {
 	table = (ListTable *)_heap[_listsSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_listsSegId, offset);
 	return &table->at(offset);
@@ -517,6 +526,7 @@ Node *SegManager::allocateNode(reg_t *addr) {
 	table = (NodeTable *)_heap[_nodesSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_nodesSegId, offset);
 	return &table->at(offset);
@@ -902,6 +912,7 @@ byte *SegManager::allocDynmem(int size, const char *descr, reg_t *addr) {
 	SegmentId seg;
 	SegmentObj *mobj = allocSegment(new DynMem(), &seg);
 	*addr = make_reg(seg, 0);
+	++_allocationsSinceGC;
 
 	DynMem &d = *(DynMem *)mobj;
 
@@ -944,6 +955,7 @@ SciArray *SegManager::allocateArray(SciArrayType type, uint16 size, reg_t *addr)
 		table = (ArrayTable *)_heap[_arraysSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_arraysSegId, offset);
 
@@ -1000,6 +1012,7 @@ SciBitmap *SegManager::allocateBitmap(reg_t *addr, const int16 width, const int1
 	}
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_bitmapSegId, offset);
 	SciBitmap &bitmap = table->at(offset);
@@ -1131,6 +1144,7 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (!scr->getLockers()) {
 		// The actual script deletion seems to be done by SCI scripts themselves
 		scr->markDeleted();
+		++_allocationsSinceGC;
 		debugC(kDebugLevelScripts, "Unloaded script 0x%x.", script_nr);
 	}
 }
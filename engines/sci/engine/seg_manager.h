@@ -463,6 +463,14 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	/**
+	 * Returns the number of garbage collectable entities (clones, lists,
+	 * nodes, hunks, dynmem, arrays, bitmaps and disposed scripts) which have
+	 * been created or released since the last garbage collection.
+	 */
+	uint getAllocationsSinceGC() const { return _allocationsSinceGC; }
+	void resetAllocationsSinceGC() { _allocationsSinceGC = 0; }
+
 private:
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
@@ -481,6 +489,8 @@ private:
 	reg_t _saveDirPtr;
 	reg_t _parserPtr;
 
+	uint _allocationsSinceGC;
+
 #ifdef ENABLE_SCI32
 	SegmentId _arraysSegId;
 	SegmentId _bitmapSegId;
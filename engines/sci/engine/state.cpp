@@ -76,9 +76,12 @@ EngineState::EngineState(SegManager *segMan)
 
 EngineState::~EngineState() {
 	delete _msgState;
+	clearAvoidPathCache();
 }
 
 void EngineState::reset(bool isRestoring) {
+	clearAvoidPathCache();
+
 	if (!isRestoring) {
 		_memorySegmentSize = 0;
 		_fileHandles.resize(5);
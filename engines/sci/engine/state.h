@@ -83,6 +83,35 @@ enum VideoFlags {
 	kStretch         = 1 << 8
 };
 
+/**
+ * Pause and throughput statistics of the garbage collector.
+ */
+struct GCStatistics {
+	uint32 runs; //< The number of completed collections
+	uint32 skippedRuns; //< The number of periodic collections skipped because nothing collectable had been allocated
+	uint32 totalTime; //< The total time spent collecting, in milliseconds
+	uint32 maxTime; //< The longest collection pause, in milliseconds
+	uint32 lastTime; //< The duration of the most recent collection, in milliseconds
+	uint32 totalFreed; //< The number of entities freed over all collections
+	uint32 lastFreed; //< The number of entities freed by the most recent collection
+	uint32 lastReachable; //< The number of reachable addresses found by the most recent collection
+	uint32 lastAllocations; //< The number of collectable entities allocated between the two most recent collections
+
+	GCStatistics() { reset(); }
+
+	void reset() {
+		runs = 0;
+		skippedRuns = 0;
+		totalTime = 0;
+		maxTime = 0;
+		lastTime = 0;
+		totalFreed = 0;
+		lastFreed = 0;
+		lastReachable = 0;
+		lastAllocations = 0;
+	}
+};
+
 /**
  * Trace information about a VM function call.
  */
@@ -195,6 +224,7 @@ public:
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GCStatistics gcStats;
 
 	MessageState *_msgState;
 
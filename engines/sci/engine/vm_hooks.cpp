@@ -179,6 +179,11 @@ bool hook_exec_match(Sci::EngineState *s, HookEntry entry) {
 }
 
 void VmHooks::vm_hook_before_exec(Sci::EngineState *s) {
+	// Most games have no hooks at all, so avoid looking up the script for
+	// every executed instruction
+	if (_hooksMap.empty())
+		return;
+
 	if (_just_finished) {
 		_just_finished = false;
 		_lastPc = NULL_REG;
@@ -20,6 +20,7 @@
  *
  */
 
+#include "sci/console.h"
 #include "sci/resource/resource.h"
 #include "sci/engine/features.h"
 #include "sci/engine/seg_manager.h"
@@ -82,6 +83,76 @@ const CelScalerTable &CelScaler::getScalerTable(const Ratio &scaleX, const Ratio
 	return _scaleTables[_activeIndex];
 }
 
+#pragma mark -
+#pragma mark CelPixelCache
+
+CelPixels CelPixelCache::find(const CelInfo32 &celInfo) {
+	EntryMap::iterator it = _entries.find(celInfo);
+	if (it == _entries.end()) {
+		++_misses;
+		return CelPixels();
+	}
+
+	++_hits;
+	it->_value.id = ++_nextId;
+	return it->_value.pixels;
+}
+
+void CelPixelCache::insert(const CelInfo32 &celInfo, const CelPixels &pixels) {
+	const uint32 size = pixels->size();
+	if (size > _maxMemory) {
+		++_rejections;
+		return;
+	}
+
+	EntryMap::iterator it = _entries.find(celInfo);
+	if (it != _entries.end()) {
+		_memory -= it->_value.pixels->size();
+		_entries.erase(it);
+	}
+
+	while (_memory + size > _maxMemory && !_entries.empty()) {
+		evictOldest();
+	}
+
+	CelPixelCacheEntry &entry = _entries[celInfo];
+	entry.id = ++_nextId;
+	entry.pixels = pixels;
+	_memory += size;
+}
+
+void CelPixelCache::evictOldest() {
+	EntryMap::iterator oldest = _entries.begin();
+	for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+		if (it->_value.id < oldest->_value.id) {
+			oldest = it;
+		}
+	}
+
+	_memory -= oldest->_value.pixels->size();
+	_entries.erase(oldest);
+	++_evictions;
+}
+
+void CelPixelCache::clear() {
+	_entries.clear();
+	_memory = 0;
+}
+
+void CelPixelCache::resetStats() {
+	_hits = 0;
+	_misses = 0;
+	_evictions = 0;
+	_rejections = 0;
+}
+
+void CelPixelCache::printStats(Console *con) const {
+	const uint32 lookups = _hits + _misses;
+	con->debugPrintf("Cel pixel cache: %u cels, %u of %u KiB used\n", _entries.size(), _memory / 1024, _maxMemory / 1024);
+	con->debugPrintf(" hits: %u, misses: %u (%u%% hit rate)\n", _hits, _misses, lookups ? _hits * 100 / lookups : 0);
+	con->debugPrintf(" evictions: %u, too large to cache: %u\n", _evictions, _rejections);
+}
+
 #pragma mark -
 #pragma mark CelObj
 bool CelObj::_drawBlackLines = false;
@@ -92,11 +163,18 @@ void CelObj::init() {
 	_nextCacheId = 1;
 	_scaler.reset(new CelScaler());
 	_cache.reset(new CelCache(100));
+
+	// The budget for decompressed cel pixels is given in KiB
+	const int pixelCacheSize = ConfMan.hasKey("sci_cel_cache_size") ? ConfMan.getInt("sci_cel_cache_size") : 4096;
+	if (pixelCacheSize > 0) {
+		_pixelCache.reset(new CelPixelCache(pixelCacheSize * 1024));
+	}
 }
 
 void CelObj::deinit() {
 	_scaler.reset();
 	_cache.reset();
+	_pixelCache.reset();
 }
 
 #pragma mark -
@@ -355,14 +433,71 @@ private:
 	uint32 _dataOffset;
 	uint32 _uncompressedDataOffset;
 	int16 _y;
+	const int16 _sourceWidth;
 	const int16 _sourceHeight;
 	const uint8 _skipColor;
 	const int16 _maxWidth;
+	// If _pixels is set, it contains the entire decompressed cel from the
+	// cel pixel cache and takes precedence over row-by-row decompression.
+	CelPixels _pixels;
+
+	void decompressRow(const int16 y, const int16 maxWidth) {
+		// compressed data segment for row
+		const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
+
+		uint32 rowCompressedSize;
+		if (y + 1 < _sourceHeight) {
+			rowCompressedSize = _resource.getUint32SEAt(_controlOffset + (y + 1) * sizeof(uint32)) - rowOffset;
+		} else {
+			rowCompressedSize = _resource.size() - rowOffset - _dataOffset;
+		}
+
+		const byte *row = _resource.getUnsafeDataAt(_dataOffset + rowOffset, rowCompressedSize);
+
+		// uncompressed data segment for row
+		const uint32 literalOffset = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + y * sizeof(uint32));
+
+		uint32 literalRowSize;
+		if (y + 1 < _sourceHeight) {
+			literalRowSize = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + (y + 1) * sizeof(uint32)) - literalOffset;
+		} else {
+			literalRowSize = _resource.size() - literalOffset - _uncompressedDataOffset;
+		}
+
+		const byte *literal = _resource.getUnsafeDataAt(_uncompressedDataOffset + literalOffset, literalRowSize);
+
+		uint8 length;
+		for (int16 i = 0; i < maxWidth; i += length) {
+			const byte controlByte = *row++;
+			length = controlByte;
+
+			// Run-length encoded
+			if (controlByte & 0x80) {
+				length &= 0x3F;
+				assert(i + length < (int)sizeof(_buffer));
+
+				// Fill with skip color
+				if (controlByte & 0x40) {
+					memset(_buffer + i, _skipColor, length);
+				// Next value is fill color
+				} else {
+					memset(_buffer + i, *literal, length);
+					++literal;
+				}
+			// Uncompressed
+			} else {
+				assert(i + length < (int)sizeof(_buffer));
+				memcpy(_buffer + i, literal, length);
+				literal += length;
+			}
+		}
+	}
 
 public:
 	READER_Compressed(const CelObj &celObj, const int16 maxWidth) :
 	_resource(celObj.getResPointer()),
 	_y(-1),
+	_sourceWidth(celObj._width),
 	_sourceHeight(celObj._height),
 	_skipColor(celObj._skipColor),
 	_maxWidth(maxWidth) {
@@ -372,60 +507,35 @@ public:
 		_dataOffset = celHeader.getUint32SEAt(24);
 		_uncompressedDataOffset = celHeader.getUint32SEAt(28);
 		_controlOffset = celHeader.getUint32SEAt(32);
-	}
-
-	inline const byte *getRow(const int16 y) {
-		assert(y >= 0 && y < _sourceHeight);
-		if (y != _y) {
-			// compressed data segment for row
-			const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
-
-			uint32 rowCompressedSize;
-			if (y + 1 < _sourceHeight) {
-				rowCompressedSize = _resource.getUint32SEAt(_controlOffset + (y + 1) * sizeof(uint32)) - rowOffset;
-			} else {
-				rowCompressedSize = _resource.size() - rowOffset - _dataOffset;
-			}
-
-			const byte *row = _resource.getUnsafeDataAt(_dataOffset + rowOffset, rowCompressedSize);
 
-			// uncompressed data segment for row
-			const uint32 literalOffset = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + y * sizeof(uint32));
+		// Memory bitmaps may be changed by scripts at any time, so only cels
+		// which come from immutable resources can be cached
+		CelPixelCache *const cache = CelObj::_pixelCache.get();
+		if (cache == nullptr || (celObj._info.type != kCelTypeView && celObj._info.type != kCelTypePic)) {
+			return;
+		}
 
-			uint32 literalRowSize;
-			if (y + 1 < _sourceHeight) {
-				literalRowSize = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + (y + 1) * sizeof(uint32)) - literalOffset;
-			} else {
-				literalRowSize = _resource.size() - literalOffset - _uncompressedDataOffset;
+		_pixels = cache->find(celObj._info);
+		if (!_pixels) {
+			_pixels = CelPixels(new Common::Array<byte>(_sourceWidth * _sourceHeight));
+			byte *target = _pixels->data();
+			for (int16 y = 0; y < _sourceHeight; ++y) {
+				decompressRow(y, _sourceWidth);
+				memcpy(target, _buffer, _sourceWidth);
+				target += _sourceWidth;
 			}
+			cache->insert(celObj._info, _pixels);
+		}
+	}
 
-			const byte *literal = _resource.getUnsafeDataAt(_uncompressedDataOffset + literalOffset, literalRowSize);
-
-			uint8 length;
-			for (int16 i = 0; i < _maxWidth; i += length) {
-				const byte controlByte = *row++;
-				length = controlByte;
-
-				// Run-length encoded
-				if (controlByte & 0x80) {
-					length &= 0x3F;
-					assert(i + length < (int)sizeof(_buffer));
+	inline const byte *getRow(const int16 y) {
+		assert(y >= 0 && y < _sourceHeight);
+		if (_pixels) {
+			return _pixels->data() + y * _sourceWidth;
+		}
 
-					// Fill with skip color
-					if (controlByte & 0x40) {
-						memset(_buffer + i, _skipColor, length);
-					// Next value is fill color
-					} else {
-						memset(_buffer + i, *literal, length);
-						++literal;
-					}
-				// Uncompressed
-				} else {
-					assert(i + length < (int)sizeof(_buffer));
-					memcpy(_buffer + i, literal, length);
-					literal += length;
-				}
-			}
+		if (y != _y) {
+			decompressRow(y, _maxWidth);
 			_y = y;
 		}
 
@@ -687,6 +797,7 @@ void CelObj::submitPalette() const {
 
 int CelObj::_nextCacheId = 1;
 Common::ScopedPtr<CelCache> CelObj::_cache;
+Common::ScopedPtr<CelPixelCache> CelObj::_pixelCache;
 
 int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
 	*nextInsertIndex = -1;
@@ -23,6 +23,8 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
+#include "common/ptr.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource/resource.h"
@@ -106,7 +108,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -116,7 +118,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -152,6 +154,96 @@ struct CelCacheEntry {
 
 typedef Common::Array<CelCacheEntry> CelCache;
 
+#pragma mark -
+#pragma mark CelPixelCache
+
+struct CelInfo32Hash : public Common::UnaryFunction<CelInfo32, uint> {
+	uint operator()(const CelInfo32 &info) const {
+		return (info.type << 28) ^ (info.resourceId << 12) ^ ((uint16)info.loopNo << 6) ^ (uint16)info.celNo;
+	}
+};
+
+typedef Common::SharedPtr<Common::Array<byte> > CelPixels;
+
+struct CelPixelCacheEntry {
+	/**
+	 * A monotonically increasing cache ID used to identify the least recently
+	 * used item in the cache for eviction.
+	 */
+	int id;
+	CelPixels pixels;
+	CelPixelCacheEntry() : id(0) {}
+};
+
+class Console;
+
+/**
+ * A memory-budgeted cache of fully decompressed pixel data for RLE-compressed
+ * view and pic cels. Pixels are stored exactly as they appear in the resource,
+ * before Mac palette translation and remapping are applied by the pixel
+ * mappers, so one entry serves every remap state and mirroring of a cel.
+ */
+class CelPixelCache {
+public:
+	CelPixelCache(const uint32 maxMemory) :
+		_maxMemory(maxMemory),
+		_memory(0),
+		_nextId(1),
+		_hits(0),
+		_misses(0),
+		_evictions(0),
+		_rejections(0) {}
+
+	/**
+	 * Returns the cached pixels for the given cel, or a null pointer if the
+	 * cel is not in the cache.
+	 */
+	CelPixels find(const CelInfo32 &celInfo);
+
+	/**
+	 * Adds decompressed pixels for the given cel to the cache, evicting the
+	 * least recently used entries until the cache fits within its budget.
+	 * Pixel buffers larger than the entire budget are not cached.
+	 */
+	void insert(const CelInfo32 &celInfo, const CelPixels &pixels);
+
+	/**
+	 * Discards all cached pixel data. Statistics are kept.
+	 */
+	void clear();
+
+	/**
+	 * Resets the hit, miss, eviction, and rejection counters.
+	 */
+	void resetStats();
+
+	void printStats(Console *con) const;
+
+private:
+	typedef Common::HashMap<CelInfo32, CelPixelCacheEntry, CelInfo32Hash> EntryMap;
+
+	EntryMap _entries;
+
+	/**
+	 * The maximum number of bytes of pixel data held by the cache.
+	 */
+	uint32 _maxMemory;
+
+	/**
+	 * The number of bytes of pixel data currently held by the cache.
+	 */
+	uint32 _memory;
+
+	int _nextId;
+
+	uint32 _hits;
+	uint32 _misses;
+	uint32 _evictions;
+	uint32 _rejections;
+
+	void evictOldest();
+};
+
 #pragma mark -
 #pragma mark CelScaler
 
@@ -478,6 +570,15 @@ protected:
 	 * Puts a copy of this CelObj into the cache at the given cache index.
 	 */
 	void putCopyInCache(int index) const;
+
+public:
+	/**
+	 * A cache of decompressed pixel data for RLE-compressed cels, used to
+	 * avoid decompressing the same cel every time it is drawn. This is null
+	 * when the cache has been disabled by setting the `sci_cel_cache_size`
+	 * configuration key to 0.
+	 */
+	static Common::ScopedPtr<CelPixelCache> _pixelCache;
 };
 
 #pragma mark -
@@ -22,9 +22,11 @@
 
 // Resource library
 
+#include "common/algorithm.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #ifdef ENABLE_SCI32
@@ -1012,6 +1014,10 @@ void ResourceManager::init() {
 	_memoryLRU = 0;
 	_LRU.clear();
 	_resMap.clear();
+	_roomWorkingSets.clear();
+	_currentRoom = -1;
+	_prefetchedResources.clear();
+	resetLoadStatistics();
 	_audioMapSCI1 = NULL;
 #ifdef ENABLE_SCI32
 	_currentDiscNo = 1;
@@ -1179,6 +1185,128 @@ void ResourceManager::freeOldResources() {
 	}
 }
 
+static bool isRoomWorkingSetType(ResourceType type) {
+	switch (type) {
+	case kResourceTypeView:
+	case kResourceTypePic:
+	case kResourceTypeScript:
+	case kResourceTypeText:
+	case kResourceTypeSound:
+	case kResourceTypeFont:
+	case kResourceTypeCursor:
+	case kResourceTypePatch:
+	case kResourceTypePalette:
+	case kResourceTypeHeap:
+	case kResourceTypeMessage:
+		return true;
+	default:
+		// Audio and sync data is streamed and far too large to read ahead
+		return false;
+	}
+}
+
+// Upper bound on the number of resources remembered per room
+enum {
+	kMaxRoomWorkingSetSize = 128
+};
+
+void ResourceManager::recordLoad(Resource *res, uint32 time) {
+	LoadStatistics &stats = _loadStats[res->getType()];
+	stats.loads++;
+	stats.loadTime += time;
+	stats.maxLoadTime = MAX(stats.maxLoadTime, time);
+
+	// A prefetched resource which has to be read again was evicted before use
+	_prefetchedResources.erase(res->_id);
+
+	if (_currentRoom == -1 || !isRoomWorkingSetType(res->getType()))
+		return;
+
+	Common::Array<ResourceId> &workingSet = _roomWorkingSets[_currentRoom];
+	if (workingSet.size() < kMaxRoomWorkingSetSize && Common::find(workingSet.begin(), workingSet.end(), res->_id) == workingSet.end())
+		workingSet.push_back(res->_id);
+}
+
+void ResourceManager::resetLoadStatistics() {
+	memset(_loadStats, 0, sizeof(_loadStats));
+}
+
+struct PrefetchCandidate {
+	Resource *resource;
+	const Common::String *location;
+	int volume;
+	int32 offset;
+};
+
+static bool prefetchCandidateLess(const PrefetchCandidate &a, const PrefetchCandidate &b) {
+	const int cmp = a.location->compareTo(*b.location);
+	if (cmp != 0)
+		return cmp < 0;
+	if (a.volume != b.volume)
+		return a.volume < b.volume;
+	return a.offset < b.offset;
+}
+
+void ResourceManager::prefetchRoom(uint16 roomNumber) {
+	_currentRoom = roomNumber;
+	_prefetchedResources.clear();
+
+	Common::Array<PrefetchCandidate> candidates;
+	int budget = _maxMemoryLRU / 2;
+
+	// The room picture is nearly always needed, even on a first visit
+	const ResourceId picId(kResourceTypePic, roomNumber);
+	Common::Array<ResourceId> ids;
+	ids.push_back(picId);
+
+	RoomWorkingSetMap::const_iterator workingSet = _roomWorkingSets.find(roomNumber);
+	if (workingSet != _roomWorkingSets.end()) {
+		for (Common::Array<ResourceId>::const_iterator it = workingSet->_value.begin(); it != workingSet->_value.end(); ++it) {
+			if (*it != picId)
+				ids.push_back(*it);
+		}
+	}
+
+	for (Common::Array<ResourceId>::const_iterator it = ids.begin(); it != ids.end(); ++it) {
+		Resource *res = testResource(*it);
+		if (!res || res->_status != kResStatusNoMalloc)
+			continue;
+
+		PrefetchCandidate candidate;
+		candidate.resource = res;
+		candidate.location = &res->_source->getLocationName();
+		candidate.volume = res->_source->_volumeNumber;
+		candidate.offset = res->_fileOffset;
+		candidates.push_back(candidate);
+	}
+
+	if (candidates.empty())
+		return;
+
+	// Read in on-disk order, so that consecutive reads of the same volume
+	// do not have to seek back and forth
+	Common::sort(candidates.begin(), candidates.end(), prefetchCandidateLess);
+
+	for (Common::Array<PrefetchCandidate>::iterator it = candidates.begin(); it != candidates.end(); ++it) {
+		Resource *res = it->resource;
+		if (budget <= 0)
+			break;
+
+		loadResource(res);
+		if (res->_status != kResStatusAllocated)
+			continue;
+
+		budget -= res->size();
+		addToLRU(res);
+		_prefetchedResources.setVal(res->_id, true);
+		_loadStats[res->getType()].prefetched++;
+	}
+
+	freeOldResources();
+
+	debugC(kDebugLevelResMan, "resMan: Prefetched %d resources for room %d", _prefetchedResources.size(), roomNumber);
+}
+
 Common::List<ResourceId> ResourceManager::listResources(ResourceType type, int mapNumber) {
 	Common::List<ResourceId> resources;
 
@@ -1215,9 +1343,20 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return NULL;
 
-	if (retval->_status == kResStatusNoMalloc)
+	if (retval->_status == kResStatusNoMalloc) {
+		const uint32 loadStart = g_system->getMillis();
 		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
+		recordLoad(retval, g_system->getMillis() - loadStart);
+	} else {
+		LoadStatistics &stats = _loadStats[retval->getType()];
+		stats.hits++;
+		if (_prefetchedResources.contains(retval->_id)) {
+			_prefetchedResources.erase(retval->_id);
+			stats.prefetchHits++;
+		}
+	}
+
+	if (retval->_status == kResStatusEnqueued)
 		// The resource is removed from its current position
 		// in the LRU list because it has been requested
 		// again. Below, it will either be locked, or it
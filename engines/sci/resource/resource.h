@@ -23,6 +23,7 @@
 #ifndef SCI_RESOURCE_RESOURCE_H
 #define SCI_RESOURCE_RESOURCE_H
 
+#include "common/array.h"
 #include "common/str.h"
 #include "common/list.h"
 #include "common/hashmap.h"
@@ -369,6 +370,31 @@ public:
 	 */
 	void unlockResource(Resource *res);
 
+	/**
+	 * Loading statistics for a single resource type, as reported by the
+	 * `resource_stats` debugger command.
+	 */
+	struct LoadStatistics {
+		uint32 hits;         ///< Requests served from memory
+		uint32 loads;        ///< Requests which had to read the resource
+		uint32 loadTime;     ///< Total time spent in those reads, in ms
+		uint32 maxLoadTime;  ///< Longest single read, in ms
+		uint32 prefetched;   ///< Resources read ahead by prefetchRoom
+		uint32 prefetchHits; ///< Prefetched resources which were used later
+	};
+
+	const LoadStatistics &getLoadStatistics(ResourceType type) const { return _loadStats[type]; }
+	void resetLoadStatistics();
+
+	/**
+	 * Reads the resources that were loaded the last time the given room was
+	 * visited, so that entering the room does not stall on one disk read per
+	 * view or pic. Reads are issued in volume and file offset order and stop
+	 * once half of the LRU memory budget has been used. Also starts recording
+	 * the resources used by the room for its next visit.
+	 */
+	void prefetchRoom(uint16 roomNumber);
+
 	/**
 	 * Tests whether a resource exists.
 	 *
@@ -491,6 +517,12 @@ protected:
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
 	ResourceMap _resMap;
+
+	typedef Common::HashMap<uint16, Common::Array<ResourceId> > RoomWorkingSetMap;
+	RoomWorkingSetMap _roomWorkingSets; ///< Resources loaded in each room, used for prefetching
+	int _currentRoom; ///< Room whose working set is being recorded, or -1
+	Common::HashMap<ResourceId, bool, ResourceIdHash> _prefetchedResources; ///< Prefetched, not yet requested
+	LoadStatistics _loadStats[kResourceTypeInvalid + 1];
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
 	ResVersion _volVersion; ///< resource.0xx version
@@ -551,6 +583,7 @@ protected:
 	void disposeVolumeFileStream(Common::SeekableReadStream *fileStream, ResourceSource *source);
 	void loadResource(Resource *res);
 	void freeOldResources();
+	void recordLoad(Resource *res, uint32 time);
 	bool validateResource(const ResourceId &resourceId, const Common::String &sourceMapLocation, const Common::String &sourceName, const uint32 offset, const uint32 size, const uint32 sourceSize) const;
 	Resource *addResource(ResourceId resId, ResourceSource *src, uint32 offset, uint32 size = 0, const Common::String &sourceMapLocation = Common::String("(no map location)"));
 	Resource *updateResource(ResourceId resId, ResourceSource *src, uint32 size, const Common::String &sourceMapLocation = Common::String("(no map location)"));
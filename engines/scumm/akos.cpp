@@ -637,6 +637,65 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	} while (1);
 }
 
+void AkosRenderer::codec1_unscaledDecode(Codec1 &v1) {
+	const byte *mask, *src;
+	byte *dst;
+	byte len, maskbit, color;
+	int y;
+	uint16 height;
+	const int pitch = _out.pitch;
+	const int top = v1.boundsRect.top;
+	const int bottom = v1.boundsRect.bottom;
+
+	y = v1.y;
+	src = _srcptr;
+	dst = v1.destptr;
+	len = v1.replen;
+	color = v1.repcolor;
+	height = _height;
+
+	// Clipping against the horizontal bounds only changes between columns
+	bool columnVisible = (v1.x >= 0 && v1.x < v1.boundsRect.right);
+	maskbit = revBitMask(v1.x & 7);
+	mask = _vm->getMaskBuffer(v1.x - (_vm->_virtscr[kMainVirtScreen].xstart & 7), v1.y, _zbuf);
+
+	if (len)
+		goto StartPos;
+
+	do {
+		len = *src++;
+		color = len >> v1.shr;
+		len &= v1.mask;
+		if (!len)
+			len = *src++;
+
+		do {
+			if (color && columnVisible && y >= top && y < bottom && !(*mask & maskbit))
+				*dst = (byte)_palette[color];
+			dst += pitch;
+			mask += _numStrips;
+			y++;
+
+			if (!--height) {
+				if (!--v1.skip_width)
+					return;
+				height = _height;
+				y = v1.y;
+
+				v1.x += v1.scaleXstep;
+				if (v1.x < 0 || v1.x >= v1.boundsRect.right)
+					return;
+				columnVisible = true;
+				maskbit = revBitMask(v1.x & 7);
+				v1.destptr += v1.scaleXstep;
+				dst = v1.destptr;
+				mask = _vm->getMaskBuffer(v1.x - (_vm->_virtscr[kMainVirtScreen].xstart & 7), v1.y, _zbuf);
+			}
+		StartPos:;
+		} while (--len);
+	} while (1);
+}
+
 // This is exact duplicate of smallCostumeScaleTable[] in costume.cpp
 // See FIXME below for explanation
 const byte smallCostumeScaleTableAKOS[256] = {
@@ -998,7 +1057,12 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 	v1.height = _out.h;
 	v1.destptr = (byte *)_out.getBasePtr(v1.x, v1.y);
 
-	codec1_genericDecode(v1);
+	// Unscaled, unshadowed 8bpp draws are by far the most common case;
+	// they take a leaner decoder without the per-pixel scale and shadow tests.
+	if (!use_scaling && !_actorHitMode && _shadow_mode == 0 && _vm->_bytesPerPixel == 1)
+		codec1_unscaledDecode(v1);
+	else
+		codec1_genericDecode(v1);
 
 	return drawFlag;
 }
@@ -1147,6 +1211,21 @@ void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	}
 }
 
+// Mask and copy a decoded line in one pass, for draws without shadows
+static void akos16CopyLine(byte *dst, const byte *src, const byte *mask, byte maskbit, int32 size, byte transparency) {
+	while (size-- > 0) {
+		byte color = *src++;
+		if (color != transparency && !(*mask & maskbit))
+			*dst = color;
+		dst++;
+		maskbit >>= 1;
+		if (!maskbit) {
+			mask++;
+			maskbit = 128;
+		}
+	}
+}
+
 void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir,
 		int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf) {
 	byte *tmp_buf = _akos16.buffer;
@@ -1169,13 +1248,21 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 
 	maskptr = _vm->getMaskBuffer(maskLeft, maskTop, zBuf);
 
+	const bool HE7Check = (_vm->_game.heversion == 70);
+	// Unshadowed draws, by far the most common case, skip the separate mask
+	// and shadow passes over each line
+	const bool plainCopy = (_shadow_mode == 0 && !HE7Check);
+
 	assert(t_height > 0);
 	assert(t_width > 0);
 	while (t_height--) {
 		akos16DecodeLine(tmp_buf, t_width, dir);
-		bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
-		bool HE7Check = (_vm->_game.heversion == 70);
-		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
+		if (plainCopy) {
+			akos16CopyLine(dest, _akos16.buffer, maskptr, maskbit, t_width, transparency);
+		} else {
+			bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
+			bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
+		}
 
 		if (numskip_after != 0)	{
 			akos16SkipData(numskip_after);
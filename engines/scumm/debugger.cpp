@@ -30,10 +30,13 @@
 #include "scumm/boxes.h"
 #include "scumm/debugger.h"
 #include "scumm/imuse/imuse.h"
+#include "scumm/imuse_digi/dimuse.h"
 #include "scumm/object.h"
 #include "scumm/resource.h"
 #include "scumm/scumm.h"
+#include "scumm/scumm_v7.h"
 #include "scumm/sound.h"
+#include "scumm/smush/smush_player.h"
 
 namespace Scumm {
 
@@ -96,6 +99,11 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 
 	registerCmd("imuse",     WRAP_METHOD(ScummDebugger, Cmd_IMuse));
 
+#ifdef ENABLE_SCUMM_7_8
+	if (_vm->_game.version >= 7)
+		registerCmd("sanbench",  WRAP_METHOD(ScummDebugger, Cmd_SanBench));
+#endif
+
 	registerCmd("resetcursors",    WRAP_METHOD(ScummDebugger, Cmd_ResetCursors));
 }
 
@@ -166,6 +174,20 @@ bool ScummDebugger::Cmd_IMuse(int argc, const char **argv) {
 				debugPrintf("Specify a music resource # or \"all\".\n");
 			}
 			return true;
+#ifdef ENABLE_SCUMM_7_8
+		} else if (!strcmp(argv[1], "bundle") && _vm->_imuseDigital) {
+			BundleDirCache *cache = _vm->_imuseDigital->getBundleDirCache();
+			if (argc > 2 && !strcmp(argv[2], "reset")) {
+				cache->resetBlockCacheStats();
+				debugPrintf("Bundle statistics reset\n");
+				return true;
+			}
+
+			const BundleDirCache::BlockCacheStats &stats = cache->getBlockCacheStats();
+			debugPrintf("Decoded bundle blocks: %u cached, %u loaded\n", stats.hits, stats.misses);
+			debugPrintf("Sample reads: %u, taking %u ms in total, longest %u ms\n", stats.loads, stats.loadTime, stats.maxLoadTime);
+			return true;
+#endif
 		}
 	}
 
@@ -173,6 +195,10 @@ bool ScummDebugger::Cmd_IMuse(int argc, const char **argv) {
 	debugPrintf("  panic - Stop all music tracks\n");
 	debugPrintf("  play # - Play a music resource\n");
 	debugPrintf("  stop # - Stop a music resource\n");
+#ifdef ENABLE_SCUMM_7_8
+	if (_vm->_imuseDigital)
+		debugPrintf("  bundle [reset] - Show or reset bundle streaming statistics\n");
+#endif
 	return true;
 }
 
@@ -839,6 +865,34 @@ bool ScummDebugger::Cmd_Passcode(int argc, const char **argv) {
 	return false;
 }
 
+#ifdef ENABLE_SCUMM_7_8
+bool ScummDebugger::Cmd_SanBench(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("Usage: %s <file.san>\n", argv[0]);
+		debugPrintf("Decodes all frames of a SMUSH video as fast as possible and reports the time taken\n");
+		return true;
+	}
+
+	ScummEngine_v7 *vm = (ScummEngine_v7 *)_vm;
+	if (vm->isSmushActive()) {
+		debugPrintf("A SMUSH video is already playing\n");
+		return true;
+	}
+
+	uint32 frames, time;
+	if (!vm->_splayer->benchmark(argv[1], frames, time)) {
+		debugPrintf("Could not open %s\n", argv[1]);
+		return true;
+	}
+
+	debugPrintf("Decoded %u frames of %s in %u ms", frames, argv[1], time);
+	if (time > 0)
+		debugPrintf(" (%u fps)", frames * 1000 / time);
+	debugPrintf("\n");
+	return true;
+}
+#endif
+
 bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	_vm->resetCursors();
 	detach();
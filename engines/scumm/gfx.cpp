@@ -215,6 +215,7 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+	memset(_stripCachePalette, 0, sizeof(_stripCachePalette));
 }
 
 Gdi::~Gdi() {
@@ -275,6 +276,7 @@ void Gdi::init() {
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	clearStripCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -1967,7 +1969,73 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 			_roomPalette = _vm->_roomPalette;
 	}
 
-	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+	const byte *src = smap_ptr + offset;
+	const bool cacheable = isStripCacheable(vs);
+	if (cacheable && drawCachedStrip(dstPtr, vs->pitch, stripnr, src, height))
+		return false;
+
+	const bool transpStrip = decompressBitmap(dstPtr, vs->pitch, src, height);
+
+	// Transparent strips depend on what is already on screen, so only
+	// opaque ones can be replayed from the cache
+	if (cacheable && !transpStrip)
+		cacheStrip(dstPtr, vs->pitch, stripnr, src, height);
+
+	return transpStrip;
+}
+
+bool Gdi::isStripCacheable(const VirtScreen *vs) const {
+	// HE games can modify room images at runtime, and objects are drawn
+	// with varying transparency, so only plain room backgrounds qualify
+	return vs->number == kMainVirtScreen && !_objectMode &&
+		vs->format.bytesPerPixel == 1 && _vm->_game.heversion == 0;
+}
+
+bool Gdi::drawCachedStrip(byte *dst, int dstPitch, int stripnr, const byte *src, int height) {
+	// The codecs map colors through the room palette, which scripts can
+	// change while the room is shown
+	if (memcmp(_stripCachePalette, _roomPalette, sizeof(_stripCachePalette))) {
+		clearStripCache();
+		memcpy(_stripCachePalette, _roomPalette, sizeof(_stripCachePalette));
+		return false;
+	}
+
+	if (stripnr >= (int)_stripCache.size())
+		return false;
+
+	const StripCacheEntry &entry = _stripCache[stripnr];
+	if (entry.src != src || entry.height != height)
+		return false;
+
+	const byte *pixels = entry.pixels.begin();
+	for (int i = 0; i < height; i++) {
+		memcpy(dst, pixels, 8);
+		dst += dstPitch;
+		pixels += 8;
+	}
+
+	return true;
+}
+
+void Gdi::cacheStrip(const byte *dst, int dstPitch, int stripnr, const byte *src, int height) {
+	if (stripnr >= (int)_stripCache.size())
+		_stripCache.resize(stripnr + 1);
+
+	StripCacheEntry &entry = _stripCache[stripnr];
+	entry.src = src;
+	entry.height = height;
+	entry.pixels.resize(8 * height);
+
+	byte *pixels = entry.pixels.begin();
+	for (int i = 0; i < height; i++) {
+		memcpy(pixels, dst, 8);
+		dst += dstPitch;
+		pixels += 8;
+	}
+}
+
+void Gdi::clearStripCache() {
+	_stripCache.clear();
 }
 
 bool GdiNES::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
@@ -24,6 +24,7 @@
 #define SCUMM_GFX_H
 
 #include "common/system.h"
+#include "common/array.h"
 #include "common/list.h"
 
 #include "graphics/surface.h"
@@ -220,6 +221,20 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/**
+	 * Decompressed room background strips. Redrawing a strip, e.g. while
+	 * scrolling, then only copies the pixels instead of running the codec
+	 * again. Only opaque strips of the main virtual screen are cached, and
+	 * the cache is emptied whenever the room or its palette mapping changes.
+	 */
+	struct StripCacheEntry {
+		const byte *src;
+		int height;
+		Common::Array<byte> pixels;
+	};
+	Common::Array<StripCacheEntry> _stripCache;
+	byte _stripCachePalette[256];
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -255,6 +270,11 @@ protected:
 	/* Misc */
 	int getZPlanes(const byte *smap_ptr, const byte *zplane_list[9], bool bmapImage) const;
 
+	bool isStripCacheable(const VirtScreen *vs) const;
+	bool drawCachedStrip(byte *dst, int dstPitch, int stripnr, const byte *src, int height);
+	void cacheStrip(const byte *dst, int dstPitch, int stripnr, const byte *src, int height);
+	void clearStripCache();
+
 	virtual bool drawStrip(byte *dstPtr, VirtScreen *vs,
 					int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr);
@@ -773,9 +773,18 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dstPtr += dstInc;
+					if (type == kWizCopy) {
+						// Solid run: the color only has to be read once
+						const uint16 col = READ_LE_UINT16(dataPtr);
+						while (code--) {
+							writeColor(dstPtr, dstType, col);
+							dstPtr += dstInc;
+						}
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr += 2;
 				} else {
@@ -872,6 +881,10 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 		dstInc = -bitDepth;
 	}
 
+	// Unflipped 8-bit runs which don't depend on the destination pixels can
+	// be written with a single memset/memcpy
+	const bool blockRuns = (type != kWizXMap && bitDepth == 1 && dstInc == 1);
+
 	while (h--) {
 		xoff = srcRect.left;
 		w = srcRect.width();
@@ -907,9 +920,14 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (blockRuns) {
+						memset(dstPtr, (type == kWizRMap) ? palPtr[*dataPtr] : *dataPtr, code);
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -927,10 +945,16 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (blockRuns && type == kWizCopy) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -181,6 +181,7 @@ public:
 	int32 getCurMusicLipSyncWidth(int syncId);
 	int32 getCurMusicLipSyncHeight(int syncId);
 	int32 getSoundElapsedTimeInMs(int soundId);
+	BundleDirCache *getBundleDirCache() { return _sound->getBundleDirCache(); }
 };
 
 } // End of namespace Scumm
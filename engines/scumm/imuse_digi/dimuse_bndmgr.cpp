@@ -22,6 +22,7 @@
 
 
 #include "common/scummsys.h"
+#include "common/system.h"
 #include "scumm/scumm.h"
 #include "scumm/util.h"
 #include "scumm/file.h"
@@ -38,6 +39,10 @@ BundleDirCache::BundleDirCache() {
 		_budleDirCache[fileId].isCompressed = false;
 		_budleDirCache[fileId].indexTable = NULL;
 	}
+
+	_blockCache = NULL;
+	_blockCacheClock = 0;
+	resetBlockCacheStats();
 }
 
 BundleDirCache::~BundleDirCache() {
@@ -45,6 +50,7 @@ BundleDirCache::~BundleDirCache() {
 		free(_budleDirCache[fileId].bundleTable);
 		free(_budleDirCache[fileId].indexTable);
 	}
+	free(_blockCache);
 }
 
 BundleDirCache::AudioTable *BundleDirCache::getTable(int slot) {
@@ -63,6 +69,63 @@ bool BundleDirCache::isSndDataExtComp(int slot) {
 	return _budleDirCache[slot].isCompressed;
 }
 
+const byte *BundleDirCache::findBlock(int slot, int32 index, int32 block, int32 &outputSize) {
+	if (_blockCache) {
+		for (int i = 0; i < kBlockCacheSize; i++) {
+			DecodedBlock &entry = _blockCache[i];
+			if (entry.slot == slot && entry.index == index && entry.block == block) {
+				entry.lastUsed = ++_blockCacheClock;
+				outputSize = entry.outputSize;
+				_blockCacheStats.hits++;
+				return entry.data;
+			}
+		}
+	}
+
+	_blockCacheStats.misses++;
+	return NULL;
+}
+
+void BundleDirCache::storeBlock(int slot, int32 index, int32 block, const byte *data, int32 outputSize) {
+	if (outputSize <= 0)
+		return;
+
+	if (!_blockCache) {
+		_blockCache = (DecodedBlock *)malloc(kBlockCacheSize * sizeof(DecodedBlock));
+		if (!_blockCache)
+			return;
+		for (int i = 0; i < kBlockCacheSize; i++) {
+			_blockCache[i].slot = -1;
+			_blockCache[i].lastUsed = 0;
+		}
+	}
+
+	// Replace the least recently used block
+	DecodedBlock *victim = &_blockCache[0];
+	for (int i = 1; i < kBlockCacheSize; i++) {
+		if (_blockCache[i].lastUsed < victim->lastUsed)
+			victim = &_blockCache[i];
+	}
+
+	victim->slot = slot;
+	victim->index = index;
+	victim->block = block;
+	victim->outputSize = outputSize;
+	victim->lastUsed = ++_blockCacheClock;
+	memcpy(victim->data, data, outputSize);
+}
+
+void BundleDirCache::resetBlockCacheStats() {
+	memset(&_blockCacheStats, 0, sizeof(_blockCacheStats));
+}
+
+void BundleDirCache::recordLoad(uint32 time) {
+	_blockCacheStats.loads++;
+	_blockCacheStats.loadTime += time;
+	if (time > _blockCacheStats.maxLoadTime)
+		_blockCacheStats.maxLoadTime = time;
+}
+
 int BundleDirCache::matchFile(const char *filename) {
 	int32 tag, offset;
 	bool found = false;
@@ -186,6 +249,7 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 
 	int slot = _cache->matchFile(filename);
 	assert(slot != -1);
+	_fileBundleId = slot;
 	compressed = _cache->isSndDataExtComp(slot);
 	_numFiles = _cache->getNumFiles(slot);
 	assert(_numFiles);
@@ -284,11 +348,16 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 	uncompressedBundle = _isUncompressed;
 
+	// Time the whole read, seeks included. Single blocks are too quick for
+	// the millisecond timer, but slow storage shows up here.
+	const uint32 loadStart = g_system->getMillis();
+
 	if (_isUncompressed) {
 		_file->seek(_bundleTable[index].offset + offset + headerSize, SEEK_SET);
 		*compFinal = (byte *)malloc(size);
 		assert(*compFinal);
 		_file->read(*compFinal, size);
+		_cache->recordLoad(g_system->getMillis() - loadStart);
 		return size;
 	}
 
@@ -308,13 +377,21 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 	for (i = firstBlock; i <= lastBlock; i++) {
 		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
+			int32 cachedSize;
+			const byte *cached = _cache->findBlock(_fileBundleId, index, i, cachedSize);
+			if (cached) {
+				memcpy(_compOutputBuff, cached, cachedSize);
+				_outputSize = cachedSize;
+			} else {
+				// CMI hack: one more zero byte at the end of input buffer
+				_compInputBuff[_compTable[i].size] = 0;
+				_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
+				_file->read(_compInputBuff, _compTable[i].size);
+				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
+				if (_outputSize > 0x2000) {
+					error("_outputSize: %d", _outputSize);
+				}
+				_cache->storeBlock(_fileBundleId, index, i, _compOutputBuff, _outputSize);
 			}
 			_lastBlock = i;
 		}
@@ -347,6 +424,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 		skip = 0;
 	}
 
+	_cache->recordLoad(g_system->getMillis() - loadStart);
 	return finalSize;
 }
 
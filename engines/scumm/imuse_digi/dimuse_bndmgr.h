@@ -43,6 +43,14 @@ public:
 		int32 index;
 	};
 
+	struct BlockCacheStats {
+		uint32 hits;        // Blocks served from the decoded block cache
+		uint32 misses;      // Blocks which had to be read and decompressed
+		uint32 loads;       // Sample reads, each covering one or more blocks
+		uint32 loadTime;    // Total time spent in sample reads, in ms
+		uint32 maxLoadTime; // Longest sample read, in ms
+	};
+
 private:
 
 	struct FileDirCache {
@@ -53,6 +61,27 @@ private:
 		IndexNode *indexTable;
 	} _budleDirCache[4];
 
+	// Decompressed COMP blocks, shared by all tracks, so that looping music,
+	// jumps back into a region and crossfades between two tracks of the same
+	// sound don't read and decompress the same blocks again.
+	enum {
+		kBlockCacheSize = 64, // 64 blocks of 8 KiB each
+		kBlockSize = 0x2000
+	};
+
+	struct DecodedBlock {
+		int slot;
+		int32 index;
+		int32 block;
+		int32 outputSize;
+		uint32 lastUsed;
+		byte data[kBlockSize];
+	};
+
+	DecodedBlock *_blockCache;
+	uint32 _blockCacheClock;
+	BlockCacheStats _blockCacheStats;
+
 public:
 	BundleDirCache();
 	~BundleDirCache();
@@ -62,6 +91,12 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+
+	const byte *findBlock(int slot, int32 index, int32 block, int32 &outputSize);
+	void storeBlock(int slot, int32 index, int32 block, const byte *data, int32 outputSize);
+	const BlockCacheStats &getBlockCacheStats() const { return _blockCacheStats; }
+	void resetBlockCacheStats();
+	void recordLoad(uint32 time);
 };
 
 class BundleMgr {
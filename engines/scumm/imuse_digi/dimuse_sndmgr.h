@@ -138,6 +138,7 @@ public:
 	SoundDesc *openSound(int32 soundId, const char *soundName, int soundType, int volGroupId, int disk);
 	void closeSound(SoundDesc *soundDesc);
 	SoundDesc *cloneSound(SoundDesc *soundDesc);
+	BundleDirCache *getBundleDirCache() { return _cacheBundleDir; }
 
 	bool isSndDataExtComp(SoundDesc *soundDesc);
 	int getFreq(SoundDesc *soundDesc);
@@ -442,18 +442,16 @@ void ScummEngine::resetScriptPointer() {
 }
 
 /**
- * This method checks whether the resource that contains the active script
- * moved, and if so, updates the script pointer accordingly.
+ * Updates the script pointer after the resource that contains the active
+ * script moved.
  *
  * The script resource may have moved because it might have been garbage
  * collected by ResourceManager::expireResources.
  */
-void ScummEngine::refreshScriptPointer() {
-	if (*_lastCodePtr != _scriptOrgPointer) {
-		long oldoffs = _scriptPointer - _scriptOrgPointer;
-		getScriptBaseAddress();
-		_scriptPointer = _scriptOrgPointer + oldoffs;
-	}
+void ScummEngine::relocateScriptPointer() {
+	long oldoffs = _scriptPointer - _scriptOrgPointer;
+	getScriptBaseAddress();
+	_scriptPointer = _scriptOrgPointer + oldoffs;
 }
 
 /** Execute a script - Read opcode, and execute it from the table */
@@ -504,11 +502,6 @@ const char *ScummEngine::getOpcodeDesc(byte i) {
 #endif
 }
 
-byte ScummEngine::fetchScriptByte() {
-	refreshScriptPointer();
-	return *_scriptPointer++;
-}
-
 uint ScummEngine::fetchScriptWord() {
 	refreshScriptPointer();
 	uint a = READ_LE_UINT16(_scriptPointer);
@@ -607,8 +607,20 @@ protected:
 	void resetScriptPointer();
 	int getVerbEntrypoint(int obj, int entry);
 
-	void refreshScriptPointer();
-	byte fetchScriptByte();
+	/**
+	 * Checks whether the resource that contains the active script moved.
+	 * This runs for every operand fetched from a script, so only the check
+	 * is inline; relocateScriptPointer() does the actual update.
+	 */
+	void refreshScriptPointer() {
+		if (*_lastCodePtr != _scriptOrgPointer)
+			relocateScriptPointer();
+	}
+	void relocateScriptPointer();
+	byte fetchScriptByte() {
+		refreshScriptPointer();
+		return *_scriptPointer++;
+	}
 	virtual uint fetchScriptWord();
 	virtual int fetchScriptWordSigned();
 	uint fetchScriptDWord();
@@ -235,7 +235,9 @@ void Codec37Decoder::maketable(int pitch, int index) {
 	}
 }
 
-#if defined(SCUMM_NEED_ALIGNMENT)
+// The block primitives use fixed size memcpy/memset, which compilers turn
+// into single (unaligned where supported) word moves, and into byte
+// accesses on platforms which need aligned memory accesses.
 
 #define DECLARE_LITERAL_TEMP(v)			\
 	byte v
@@ -244,37 +246,10 @@ void Codec37Decoder::maketable(int pitch, int index) {
 	v = *src++
 
 #define WRITE_4X1_LINE(dst, v)			\
-	do {					\
-		int j;				\
-		for (j=0; j<4; j++)		\
-			(dst)[j] = v;		\
-	} while (0)
-
-#define COPY_4X1_LINE(dst, src)			\
-	do {					\
-		int j;				\
-		for (j=0; j<4; j++)		\
-			(dst)[j] = (src)[j];	\
-	} while (0)
-
-#else /* SCUMM_NEED_ALIGNMENT */
-
-#define DECLARE_LITERAL_TEMP(v)			\
-	uint32 v
-
-#define READ_LITERAL_PIXEL(src, v)			\
-	do {						\
-		v = *src++;				\
-		v += (v << 8) + (v << 16) + (v << 24);	\
-	} while (0)
-
-#define WRITE_4X1_LINE(dst, v)			\
-	*(uint32 *)(dst) = v
+	memset((dst), (v), 4)
 
 #define COPY_4X1_LINE(dst, src)			\
-	*(uint32 *)(dst) = *(const uint32 *)(src)
-
-#endif /* SCUMM_NEED_ALIGNMENT */
+	memcpy((dst), (src), 4)
 
 /* Fill a 4x4 pixel block with a literal pixel value */
 
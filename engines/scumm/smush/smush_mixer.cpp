@@ -39,6 +39,8 @@ SmushMixer::SmushMixer(Audio::Mixer *m) :
 		_channels[i].id = -1;
 		_channels[i].chan = NULL;
 		_channels[i].stream = NULL;
+		_channels[i].volume = -1;
+		_channels[i].balance = 0;
 	}
 }
 
@@ -107,6 +109,13 @@ bool SmushMixer::handleFrame() {
 				int32 size = _channels[i].chan->getAvailableSoundDataSize();
 				byte *data = _channels[i].chan->getSoundData();
 
+				// Nothing arrived for this track in this frame; avoid queueing an
+				// empty stream, which costs an allocation and a lock on the queue.
+				if (size <= 0) {
+					delete[] data;
+					continue;
+				}
+
 				byte flags = stereo ? Audio::FLAG_STEREO : 0;
 				if (is_16bit) {
 					flags |= Audio::FLAG_16BITS;
@@ -119,9 +128,16 @@ bool SmushMixer::handleFrame() {
 					if (!_channels[i].stream) {
 						_channels[i].stream = Audio::makeQueuingAudioStream(_channels[i].chan->getRate(), stereo);
 						_mixer->playStream(Audio::Mixer::kSFXSoundType, &_channels[i].handle, _channels[i].stream);
+						_channels[i].volume = -1;
+					}
+					// Each of these takes the mixer lock, so only touch the
+					// channel when the track's parameters actually changed.
+					if (vol != _channels[i].volume || pan != _channels[i].balance) {
+						_mixer->setChannelVolume(_channels[i].handle, vol);
+						_mixer->setChannelBalance(_channels[i].handle, pan);
+						_channels[i].volume = vol;
+						_channels[i].balance = pan;
 					}
-					_mixer->setChannelVolume(_channels[i].handle, vol);
-					_mixer->setChannelBalance(_channels[i].handle, pan);
 					_channels[i].stream->queueBuffer(data, size, DisposeAfterUse::YES, flags);	// The stream will free the buffer for us
 				} else
 					delete[] data;
@@ -25,7 +25,6 @@
 
 
 #include "audio/mixer.h"
-#include "common/mutex.h"
 #include "scumm/sound.h"
 
 namespace Audio {
@@ -48,12 +47,12 @@ private:
 		SmushChannel *chan;
 		Audio::SoundHandle handle;
 		Audio::QueuingAudioStream *stream;
+		int32 volume;
+		int32 balance;
 	} _channels[NUM_CHANNELS];
 
 	int _soundFrequency;
 
-	Common::Mutex _mutex;
-
 public:
 
 	SmushMixer(Audio::Mixer *);
@@ -1277,4 +1277,45 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 	CursorMan.showMouse(oldMouseState);
 }
 
+/**
+ * Decode every frame of a SAN file back to back, without waiting for the
+ * frame rate or updating the screen, and measure how long it takes.
+ * The audio chunks are still demuxed, but the sound is stopped at the end.
+ */
+bool SmushPlayer::benchmark(const char *filename, uint32 &frames, uint32 &time) {
+	ScummFile f;
+	_vm->openFile(f, filename);
+	if (!f.isOpen()) {
+		warning("SmushPlayer::benchmark() File not found %s", filename);
+		return false;
+	}
+	f.close();
+
+	const bool oldInsanity = _insanity;
+	_insanity = false;
+
+	_seekFile = filename;
+	_seekPos = 0;
+	_seekFrame = 0;
+	_base = 0;
+
+	setupAnim(filename);
+	init(_vm->_smushFrameRate);
+
+	const uint32 startTime = _vm->_system->getMillis();
+	while (!_endOfFile)
+		parseNextFrame();
+	time = _vm->_system->getMillis() - startTime;
+	frames = _frame;
+
+	_smixer->stop();
+	_vm->_mixer->stopHandle(*_compressedFileSoundHandle);
+	_vm->_mixer->stopHandle(*_IACTchannel);
+	_IACTpos = 0;
+
+	release();
+	_insanity = oldInsanity;
+	return true;
+}
+
 } // End of namespace Scumm
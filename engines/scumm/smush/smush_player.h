@@ -94,6 +94,7 @@ public:
 	void unpause();
 
 	void play(const char *filename, int32 speed, int32 offset = 0, int32 startFrame = 0);
+	bool benchmark(const char *filename, uint32 &frames, uint32 &time);
 	void release();
 	void warpMouse(int x, int y, int buttons);
 
@@ -182,6 +182,7 @@ Debugger::Debugger() : Shared::Debugger() {
 
 	registerCmd("UCMachine::getGlobal", WRAP_METHOD(Debugger, cmdGetGlobal));
 	registerCmd("UCMachine::setGlobal", WRAP_METHOD(Debugger, cmdSetGlobal));
+	registerCmd("UCMachine::execStats", WRAP_METHOD(Debugger, cmdExecStats));
 #ifdef DEBUG
 	registerCmd("UCMachine::traceObjID", WRAP_METHOD(Debugger, cmdTraceObjID));
 	registerCmd("UCMachine::tracePID", WRAP_METHOD(Debugger, cmdTracePID));
@@ -1727,6 +1728,24 @@ bool Debugger::cmdSetGlobal(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdExecStats(int argc, const char **argv) {
+	UCMachine *uc = UCMachine::get_instance();
+	if (argc > 2) {
+		debugPrintf("usage: UCMachine::execStats [count|reset]\n");
+		return true;
+	}
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		uc->resetExecStats();
+		debugPrintf("Usecode execution counters reset\n");
+		return true;
+	}
+
+	unsigned int count = (argc == 2) ? strtol(argv[1], 0, 0) : 20;
+	uc->execStats(count);
+	return true;
+}
+
 #ifdef DEBUG
 
 bool Debugger::cmdTracePID(int argc, const char **argv) {
@@ -71,9 +71,9 @@ public:
 	}
 
 	void append(const uint8 *e) {
-		_elements.resize((_size + 1) * _elementSize);
+		// push_back grows the storage geometrically
 		for (unsigned int i = 0; i < _elementSize; i++)
-			_elements[_size * _elementSize + i] = e[i];
+			_elements.push_back(e[i]);
 		_size++;
 	}
 
@@ -138,6 +138,15 @@ public:
 		_elements.clear();
 		_size = 0;
 	}
+
+	//! Empty the list for reuse, keeping the storage already allocated
+	void reset(unsigned int elementSize, unsigned int capacity = 0) {
+		_elements.resize(0);
+		_elementSize = elementSize;
+		_size = 0;
+		if (capacity > 0)
+			_elements.reserve(_elementSize * capacity);
+	}
 	uint32 getSize() const {
 		return _size;
 	}
@@ -152,7 +161,7 @@ public:
 	}
 
 	void copyList(const UCList &l) { // deep copy for list
-		free();
+		reset(_elementSize);
 		appendList(l);
 	}
 
@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/memstream.h"
 
 #include "ultima/ultima8/misc/pent_include.h"
@@ -123,6 +124,9 @@ UCMachine::~UCMachine() {
 	delete _convUse;
 	delete _listIDs;
 	delete _stringIDs;
+
+	for (unsigned int i = 0; i < _listPool.size(); ++i)
+		delete _listPool[i];
 }
 
 void UCMachine::reset() {
@@ -150,6 +154,13 @@ void UCMachine::reset() {
 void UCMachine::loadIntrinsics(Intrinsic *i, unsigned int icount) {
 	_intrinsics = i;
 	_intrinsicCount = icount;
+	resetExecStats();
+}
+
+void UCMachine::resetExecStats() {
+	memset(_opcodeCounts, 0, sizeof(_opcodeCounts));
+	_intrinsicCounts.clear();
+	_intrinsicCounts.resize(_intrinsicCount, 0);
 }
 
 void UCMachine::execProcess(UCProcess *p) {
@@ -179,6 +190,7 @@ void UCMachine::execProcess(UCProcess *p) {
 		//! guard against other error conditions
 
 		uint8 opcode = cs->readByte();
+		_opcodeCounts[opcode]++;
 
 #ifdef DEBUG
 		uint16 trace_classid = p->_classId;
@@ -345,7 +357,7 @@ void UCMachine::execProcess(UCProcess *p) {
 			// (list is created in reverse order)
 			ui16a = cs->readByte();
 			ui16b = cs->readByte();
-			UCList *l = new UCList(ui16a, ui16b);
+			UCList *l = allocList(ui16a, ui16b);
 			p->_stack.addSP(ui16a * (ui16b - 1));
 			for (unsigned int i = 0; i < ui16b; i++) {
 				l->append(p->_stack.access());
@@ -375,14 +387,13 @@ void UCMachine::execProcess(UCProcess *p) {
 
 				if (arg_bytes >= 4) {
 					// HACKHACKHACK to check what the argument is.
-					uint8 *argmem = new uint8[arg_bytes];
+					uint8 argmem[4];
 					uint8 *args = argmem;
 					p->_stack.pop(args, 4);
 					p->_stack.addSP(-4); // don't really pop the args
 					ARG_UC_PTR(iptr);
 					uint16 testItemId = ptrToObject(iptr);
 					testItem = getItem(testItemId);
-					delete [] argmem;
 				}
 				perr << "Unhandled intrinsic << " << func << " \'" << _convUse->intrinsics()[func] << "\'? (";
 				if (testItem) {
@@ -402,13 +413,13 @@ void UCMachine::execProcess(UCProcess *p) {
 				        _intrinsics[func] == UCMachine::I_true) {
 //						perr << "Unhandled intrinsic \'" << _convUse->_intrinsics()[func] << "\' (" << ConsoleStream::hex << func << ConsoleStream::dec << ") called" << Std::endl;
 				}
-				uint8 *argbuf = new uint8[arg_bytes];
+				// arg_bytes is read as a single byte, so this always fits
+				uint8 argbuf[256];
 				p->_stack.pop(argbuf, arg_bytes);
 				p->_stack.addSP(-arg_bytes); // don't really pop the args
 
+				_intrinsicCounts[func]++;
 				p->_temp32 = _intrinsics[func](argbuf, arg_bytes);
-
-				delete[] argbuf;
 			}
 
 			// REALLY MAJOR HACK:
@@ -1085,7 +1096,7 @@ void UCMachine::execProcess(UCProcess *p) {
 			si8a = cs->readSByte();
 			ui16a = cs->readByte();
 			ui16b = p->_stack.access2(p->_bp + si8a);
-			UCList *l = new UCList(ui16a);
+			UCList *l = allocList(ui16a);
 			if (getList(ui16b)) {
 				l->copyList(*getList(ui16b));
 			} else {
@@ -1107,7 +1118,7 @@ void UCMachine::execProcess(UCProcess *p) {
 			si8a = cs->readSByte();
 			ui16a = 2;
 			ui16b = p->_stack.access2(p->_bp + si8a);
-			UCList *l = new UCList(ui16a);
+			UCList *l = allocList(ui16a);
 			if (getList(ui16b)) {
 				l->copyStringList(*getList(ui16b));
 			} else {
@@ -1630,13 +1641,13 @@ void UCMachine::execProcess(UCProcess *p) {
 				ui16b = duplicateString(ui16a);
 				break;
 			case 2: { // slist
-				UCList *l = new UCList(2);
+				UCList *l = allocList(2);
 				const UCList *srclist = getList(ui16a);
 				if (!srclist) {
 					perr << "Warning: invalid src list passed to slist copy"
 						 << Std::endl;
 					ui16b = 0;
-					delete l;
+					releaseList(l);
 					break;
 				}
 				l->copyStringList(*srclist);
@@ -1652,7 +1663,7 @@ void UCMachine::execProcess(UCProcess *p) {
 					break;
 				}
 				int elementsize = l->getElementSize();
-				UCList *l2 = new UCList(elementsize);
+				UCList *l2 = allocList(elementsize);
 				l2->copyList(*l);
 				ui16b = assignList(l2);
 			}
@@ -1739,7 +1750,7 @@ void UCMachine::execProcess(UCProcess *p) {
 			bool recurse = false;
 			// we'll put everything on the stack after stacksize is set
 
-			UCList *itemlist = new UCList(2);
+			UCList *itemlist = allocList(2);
 
 			World *world = World::get_instance();
 
@@ -2088,6 +2099,24 @@ uint16 UCMachine::assignList(UCList *l) {
 	return id;
 }
 
+UCList *UCMachine::allocList(unsigned int elementSize, unsigned int capacity) {
+	if (_listPool.empty())
+		return new UCList(elementSize, capacity);
+
+	UCList *l = _listPool.back();
+	_listPool.pop_back();
+	l->reset(elementSize, capacity);
+	return l;
+}
+
+void UCMachine::releaseList(UCList *l) {
+	// Keep a bounded number around; most usecode only has a few lists alive
+	if (_listPool.size() < 64)
+		_listPool.push_back(l);
+	else
+		delete l;
+}
+
 void UCMachine::freeString(uint16 s) {
 	//! There's still a semi-bug in some places that string 0 can be assigned
 	//! (when something accesses _stringHeap[0])
@@ -2103,8 +2132,7 @@ void UCMachine::freeString(uint16 s) {
 void UCMachine::freeList(uint16 l) {
 	Std::map<uint16, UCList *>::iterator iter = _listHeap.find(l);
 	if (iter != _listHeap.end() && iter->_value) {
-		iter->_value->free();
-		delete iter->_value;
+		releaseList(iter->_value);
 		_listHeap.erase(iter);
 		_listIDs->clearID(l);
 	}
@@ -2114,7 +2142,7 @@ void UCMachine::freeStringList(uint16 l) {
 	Std::map<uint16, UCList *>::iterator iter = _listHeap.find(l);
 	if (iter != _listHeap.end() && iter->_value) {
 		iter->_value->freeStrings();
-		delete iter->_value;
+		releaseList(iter->_value);
 		_listHeap.erase(iter);
 		_listIDs->clearID(l);
 	}
@@ -2297,6 +2325,48 @@ uint16 UCMachine::ptrToObject(uint32 ptr) {
 	}
 }
 
+struct ExecCount {
+	uint16 _index;
+	uint32 _count;
+};
+
+static bool execCountGreater(const ExecCount &a, const ExecCount &b) {
+	return a._count > b._count;
+}
+
+void UCMachine::execStats(unsigned int maxShown) const {
+	Common::Array<ExecCount> counts;
+	uint64 total = 0;
+	for (unsigned int i = 0; i < 256; ++i) {
+		if (!_opcodeCounts[i])
+			continue;
+		ExecCount c = { static_cast<uint16>(i), _opcodeCounts[i] };
+		counts.push_back(c);
+		total += _opcodeCounts[i];
+	}
+	Common::sort(counts.begin(), counts.end(), execCountGreater);
+
+	g_debugger->debugPrintf("Usecode opcodes executed: %u\n", (uint32)total);
+	for (unsigned int i = 0; i < counts.size() && i < maxShown; ++i)
+		g_debugger->debugPrintf("  %02X: %u\n", counts[i]._index, counts[i]._count);
+
+	counts.clear();
+	total = 0;
+	for (unsigned int i = 0; i < _intrinsicCounts.size(); ++i) {
+		if (!_intrinsicCounts[i])
+			continue;
+		ExecCount c = { static_cast<uint16>(i), _intrinsicCounts[i] };
+		counts.push_back(c);
+		total += _intrinsicCounts[i];
+	}
+	Common::sort(counts.begin(), counts.end(), execCountGreater);
+
+	g_debugger->debugPrintf("Intrinsics called: %u\n", (uint32)total);
+	for (unsigned int i = 0; i < counts.size() && i < maxShown; ++i)
+		g_debugger->debugPrintf("  %04X %s: %u\n", counts[i]._index,
+			_convUse->intrinsics()[counts[i]._index], counts[i]._count);
+}
+
 void UCMachine::usecodeStats() const {
 	g_debugger->debugPrintf("Usecode Machine memory stats:\n");
 	g_debugger->debugPrintf("Strings    : %u/65534\n", _stringHeap.size());
@@ -63,6 +63,10 @@ public:
 
 	void usecodeStats() const;
 
+	//! Print the most frequently executed opcodes and intrinsics
+	void execStats(unsigned int maxShown) const;
+	void resetExecStats();
+
 	static uint32 listToPtr(uint16 l);
 	static uint32 stringToPtr(uint16 s);
 	static uint32 stackToPtr(uint16 pid, uint16 offset);
@@ -98,6 +102,10 @@ private:
 	Intrinsic *_intrinsics;
 	unsigned int _intrinsicCount;
 
+	// execution counters, reported by execStats()
+	uint32 _opcodeCounts[256];
+	Std::vector<uint32> _intrinsicCounts;
+
 	GlobalStorage *_globals;
 
 	Std::map<uint16, UCList *> _listHeap;
@@ -107,6 +115,11 @@ private:
 	uint16 assignString(const char *str);
 	uint16 assignList(UCList *l);
 
+	// Freed lists are kept for reuse, so list opcodes don't allocate every time
+	Std::vector<UCList *> _listPool;
+	UCList *allocList(unsigned int elementSize, unsigned int capacity = 0);
+	void releaseList(UCList *l);
+
 	idMan *_listIDs;
 	idMan *_stringIDs;
 
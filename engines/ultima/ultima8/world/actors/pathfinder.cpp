@@ -50,6 +50,9 @@ struct PathNode {
 // NOTE: this is just to keep some statistics
 static unsigned int expandednodes = 0;
 
+// Number of PathNodes allocated at once
+static const unsigned int NODE_BLOCK_SIZE = 64;
+
 void PathfindingState::load(const Actor *_actor) {
 	_actor->getLocation(_x, _y, _z);
 	_lastAnim = _actor->getLastAnim();
@@ -118,23 +121,40 @@ bool PathNodeCmp::operator()(const PathNode *n1, const PathNode *n2) const {
 
 Pathfinder::Pathfinder() : _actor(nullptr), _targetItem(nullptr),
 		_hitMode(false), _expandTime(0), _targetX(0), _targetY(0),
-		_targetZ(0), _actorXd(0), _actorYd(0), _actorZd(0) {
+		_targetZ(0), _actorXd(0), _actorYd(0), _actorZd(0), _nodeBlockUsed(0) {
 	expandednodes = 0;
 	_visited.reserve(1500);
 }
 
 Pathfinder::~Pathfinder() {
 #if 1
-	pout << "~Pathfinder: " << _cleanupNodes.size() << " nodes to clean up, visited "
+	pout << "~Pathfinder: " << numAllocatedNodes() << " nodes to clean up, visited "
 		 << _visited.size() << " and "
 	     << expandednodes << " expanded nodes in " << _expandTime << "ms." << Std::endl;
 #endif
 
 	// clean up _nodes
 	Std::vector<PathNode *>::iterator iter;
-	for (iter = _cleanupNodes.begin(); iter != _cleanupNodes.end(); ++iter)
-		delete *iter;
-	_cleanupNodes.clear();
+	for (iter = _nodeBlocks.begin(); iter != _nodeBlocks.end(); ++iter)
+		delete[] *iter;
+	_nodeBlocks.clear();
+}
+
+PathNode *Pathfinder::allocNode() {
+	if (_nodeBlocks.empty() || _nodeBlockUsed == NODE_BLOCK_SIZE) {
+		_nodeBlocks.push_back(new PathNode[NODE_BLOCK_SIZE]);
+		_nodeBlockUsed = 0;
+	}
+
+	PathNode *node = &_nodeBlocks.back()[_nodeBlockUsed++];
+	*node = PathNode();
+	return node;
+}
+
+unsigned int Pathfinder::numAllocatedNodes() const {
+	if (_nodeBlocks.empty())
+		return 0;
+	return (_nodeBlocks.size() - 1) * NODE_BLOCK_SIZE + _nodeBlockUsed;
 }
 
 void Pathfinder::init(Actor *actor, PathfindingState *state) {
@@ -363,7 +383,7 @@ static void drawpath(PathNode *to, uint32 rgb, bool done) {
 
 void Pathfinder::newNode(PathNode *oldnode, PathfindingState &state,
 						 unsigned int steps) {
-	PathNode *newnode = new PathNode();
+	PathNode *newnode = allocNode();
 	newnode->state = state;
 	newnode->parent = oldnode;
 	newnode->depth = oldnode->depth + 1;
@@ -538,7 +558,7 @@ bool Pathfinder::pathfind(Std::vector<PathfindingAction> &path) {
 
 	path.clear();
 
-	PathNode *startnode = new PathNode();
+	PathNode *startnode = allocNode();
 	startnode->state = _start;
 	startnode->cost = 0;
 	startnode->parent = nullptr;
@@ -553,9 +573,9 @@ bool Pathfinder::pathfind(Std::vector<PathfindingAction> &path) {
 	uint32 starttime = g_system->getMillis();
 
 	while (expandedNodes < NODELIMIT_MAX && !_nodes.empty() && !found) {
-		// Take a copy here as the pop() below deletes the old node
-		PathNode *node = new PathNode(*_nodes.top());
-		_cleanupNodes.push_back(node);
+		// Nodes are owned by the node blocks, so the pointer stays valid
+		// after it leaves the queue
+		PathNode *node = _nodes.top();
 		_nodes.pop();
 
 #if 0
@@ -96,8 +96,12 @@ protected:
 	Common::Array<PathfindingState> _visited;
 	Std::priority_queue<PathNode *, Std::vector<PathNode *>, PathNodeCmp> _nodes;
 
-	/** List of nodes for garbage collection later and order is not important */
-	Std::vector<PathNode *> _cleanupNodes;
+	/** Nodes are allocated from these blocks and all freed with the Pathfinder */
+	Std::vector<PathNode *> _nodeBlocks;
+	unsigned int _nodeBlockUsed;
+
+	PathNode *allocNode();
+	unsigned int numAllocatedNodes() const;
 
 	bool alreadyVisited(int32 x, int32 y, int32 z) const;
 	void newNode(PathNode *oldnode, PathfindingState &state,
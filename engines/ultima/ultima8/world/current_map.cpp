@@ -767,9 +767,13 @@ bool CurrentMap::isValidPosition(int32 x, int32 y, int32 z,
 	ObjId roof = 0;
 	int32 roofz = INT_MAX_VALUE;
 
-	int minx = ((x - xd) / _mapChunkSize) - 1;
+	// Items are stored in the chunk containing their (x,y) location, which
+	// is the far corner of their footpad, so items in lower chunks can never
+	// reach into the area being tested. Only look one chunk further out in
+	// the positive direction.
+	int minx = ((x - xd) / _mapChunkSize);
 	int maxx = (x / _mapChunkSize) + 1;
-	int miny = ((y - yd) / _mapChunkSize) - 1;
+	int miny = ((y - yd) / _mapChunkSize);
 	int maxy = (y / _mapChunkSize) + 1;
 	clipMapChunks(minx, maxx, miny, maxy);
 
@@ -1033,15 +1037,17 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
 						   Std::list<SweepItem> *hit) const {
 	const uint32 blockflagmask = (ShapeInfo::SI_SOLID | ShapeInfo::SI_DAMAGING | ShapeInfo::SI_LAND);
 
-	int minx = ((start[0] - dims[0]) / _mapChunkSize) - 1;
+	// As in isValidPosition, items in chunks below the swept area can't
+	// touch it, so only extend the range in the positive direction.
+	int minx = ((start[0] - dims[0]) / _mapChunkSize);
 	int maxx = (start[0] / _mapChunkSize) + 1;
-	int miny = ((start[1] - dims[1]) / _mapChunkSize) - 1;
+	int miny = ((start[1] - dims[1]) / _mapChunkSize);
 	int maxy = (start[1] / _mapChunkSize) + 1;
 
 	{
-		int dminx = ((end[0] - dims[0]) / _mapChunkSize) - 1;
+		int dminx = ((end[0] - dims[0]) / _mapChunkSize);
 		int dmaxx = (end[0] / _mapChunkSize) + 1;
-		int dminy = ((end[1] - dims[1]) / _mapChunkSize) - 1;
+		int dminy = ((end[1] - dims[1]) / _mapChunkSize);
 		int dmaxy = (end[1] / _mapChunkSize) + 1;
 		if (dminx < minx)
 			minx = dminx;
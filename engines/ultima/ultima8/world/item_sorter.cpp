@@ -44,7 +44,9 @@ namespace Ultima8 {
 
 ItemSorter::ItemSorter() :
 	_shapes(nullptr), _surf(nullptr), _items(nullptr), _itemsTail(nullptr),
-	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0) {
+	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0),
+	_reusingList(false), _reuseCount(0), _gridWidth(0), _gridHeight(0),
+	_nearStamp(0) {
 	int i = 2048;
 	while (i--) _itemsUnused = new SortItem(_itemsUnused);
 }
@@ -72,7 +74,35 @@ void ItemSorter::BeginDisplayList(RenderSurface *rs,
 	// Get the _shapes, if required
 	if (!_shapes) _shapes = GameData::get_instance()->getMainShapes();
 
-	//
+	// Screenspace bounding box bottom x coord (RNB x coord)
+	int32 camSx = (camx - camy) / 4;
+	// Screenspace bounding box bottom extent  (RNB y coord)
+	int32 camSy = (camx + camy) / 8 - camz;
+
+	Rect clipRect;
+	rs->GetClippingRect(clipRect);
+
+	// If the view hasn't changed, keep the previous list around. Should the
+	// same items be added again, it can be painted without sorting.
+	_reusingList = _items && rs == _surf && camSx == _camSx && camSy == _camSy &&
+	               clipRect == _clipRect;
+	_reuseCount = 0;
+
+	if (!_reusingList)
+		ClearDisplayList();
+
+	// Set the RenderSurface, and reset the item list
+	_surf = rs;
+	_orderCounter = 0;
+	_camSx = camSx;
+	_camSy = camSy;
+	_clipRect = clipRect;
+
+	if (!_reusingList)
+		ResetGrid();
+}
+
+void ItemSorter::ClearSortItems() {
 	if (_itemsTail) {
 		_itemsTail->_next = _itemsUnused;
 		_itemsUnused = _items;
@@ -80,27 +110,133 @@ void ItemSorter::BeginDisplayList(RenderSurface *rs,
 	_items = nullptr;
 	_itemsTail = nullptr;
 
-	// Set the RenderSurface, and reset the item list
-	_surf = rs;
-	_orderCounter = 0;
+	// Empty the cells, but keep their storage for the next frame
+	for (uint i = 0; i < _grid.size(); i++)
+		_grid[i].resize(0);
+}
 
-	// Screenspace bounding box bottom x coord (RNB x coord)
-	_camSx = (camx - camy) / 4;
-	// Screenspace bounding box bottom extent  (RNB y coord)
-	_camSy = (camx + camy) / 8 - camz;
+void ItemSorter::ClearDisplayList() {
+	ClearSortItems();
+	_listArgs.clear();
+}
+
+void ItemSorter::RebuildDisplayList() {
+	// This frame differs from the previous one after all. Sort from scratch,
+	// starting with the items that matched so far.
+	_reusingList = false;
+	ClearSortItems();
+
+	_listArgs.resize(_reuseCount);
+	for (uint i = 0; i < _reuseCount; i++)
+		AddSortItem(_listArgs[i]);
+}
+
+void ItemSorter::ResetGrid() {
+	int32 width = MAX<int32>(1, (_clipRect.width() + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+	int32 height = MAX<int32>(1, (_clipRect.height() + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+
+	if (width != _gridWidth || height != _gridHeight) {
+		_gridWidth = width;
+		_gridHeight = height;
+		_grid.clear();
+		_grid.resize(width * height);
+	}
+}
+
+void ItemSorter::GetGridCells(const SortItem *si, int32 &x1, int32 &y1, int32 &x2, int32 &y2) const {
+	// Clamping to the grid keeps the mapping monotonic, so items whose
+	// bounding boxes intersect always share a cell, even off screen
+	const int32 maxX = _gridWidth * GRID_CELL_SIZE - 1;
+	const int32 maxY = _gridHeight * GRID_CELL_SIZE - 1;
+
+	x1 = CLIP<int32>(si->_sxLeft - _clipRect.left, 0, maxX) / GRID_CELL_SIZE;
+	x2 = CLIP<int32>(si->_sxRight - _clipRect.left, 0, maxX) / GRID_CELL_SIZE;
+	y1 = CLIP<int32>(si->_syTop - _clipRect.top, 0, maxY) / GRID_CELL_SIZE;
+	y2 = CLIP<int32>(si->_syBot - _clipRect.top, 0, maxY) / GRID_CELL_SIZE;
+}
+
+uint32 ItemSorter::MarkNearItems(const SortItem *si) {
+	if (++_nearStamp == 0) {
+		// Wrapped around, forget the old marks
+		for (SortItem *it = _items; it != nullptr; it = it->_next)
+			it->_nearStamp = 0;
+		_nearStamp = 1;
+	}
+
+	int32 x1, y1, x2, y2;
+	GetGridCells(si, x1, y1, x2, y2);
+
+	uint32 count = 0;
+	for (int32 cy = y1; cy <= y2; cy++) {
+		for (int32 cx = x1; cx <= x2; cx++) {
+			const Std::vector<SortItem *> &cell = _grid[cy * _gridWidth + cx];
+			for (uint i = 0; i < cell.size(); i++) {
+				if (cell[i]->_nearStamp != _nearStamp) {
+					cell[i]->_nearStamp = _nearStamp;
+					count++;
+				}
+			}
+		}
+	}
+
+	return count;
+}
+
+void ItemSorter::FinishDisplayList() {
+	if (!_reusingList)
+		return;
+
+	if (_reuseCount != _listArgs.size()) {
+		RebuildDisplayList();
+		return;
+	}
+
+	// Same items as last frame: only the painting order needs resetting
+	for (SortItem *it = _items; it != nullptr; it = it->_next)
+		it->_order = -1;
+
+	_reusingList = false;
 }
 
 void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 frame_num, uint32 flags, uint32 ext_flags, uint16 itemNum) {
+	ItemArgs args;
+	args._x = x;
+	args._y = y;
+	args._z = z;
+	args._shapeNum = shapeNum;
+	args._frame = frame_num;
+	args._flags = flags;
+	args._extFlags = ext_flags;
+	args._itemNum = itemNum;
+
+	if (_reusingList) {
+		if (_reuseCount < _listArgs.size() && _listArgs[_reuseCount] == args) {
+			_reuseCount++;
+			return;
+		}
+		RebuildDisplayList();
+	}
+
+	_listArgs.push_back(args);
+	AddSortItem(args);
+}
+
+void ItemSorter::AddSortItem(const ItemArgs &args) {
+	const int32 x = args._x;
+	const int32 y = args._y;
+	const int32 z = args._z;
+	const uint32 shapeNum = args._shapeNum;
+	const uint32 flags = args._flags;
 
 	// First thing, get a SortItem to use (first of unused)
 	if (!_itemsUnused)
 		_itemsUnused = new SortItem(0);
 	SortItem *si = _itemsUnused;
 
-	si->_itemNum = itemNum;
+	si->_itemNum = args._itemNum;
 	si->_shape = _shapes->getShape(shapeNum);
 	si->_shapeNum = shapeNum;
-	si->_frame = frame_num;
+	si->_frame = args._frame;
 	const ShapeFrame *_frame = si->_shape ? si->_shape->getFrame(si->_frame) : nullptr;
 	if (!_frame) {
 		perr << "Invalid shape: " << si->_shapeNum << "," << si->_frame << Std::endl;
@@ -108,7 +244,7 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 	}
 
 	si->_flags = flags;
-	si->_extFlags = ext_flags;
+	si->_extFlags = args._extFlags;
 
 	const ShapeInfo *info = _shapes->getShapeInfo(shapeNum);
 	// Dimensions
@@ -173,13 +309,17 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 
 	si->_occluded = false;
 	si->_order = -1;
+	si->_nearStamp = 0;
 
 	// We will clear all the vector memory
 	// Stictly speaking the vector will sort of leak memory, since they
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
+	// Iterate the list and compare _shapes. Only the items marked as near
+	// can overlap this one, so once the insert point is found and no marked
+	// items are left, the rest of the list can be skipped.
+	uint32 nearCount = MarkNearItems(si);
 
 	// Ok,
 	SortItem *addpoint = nullptr;
@@ -188,6 +328,13 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 		if (!addpoint && si->ListLessThan(si2))
 			addpoint = si2;
 
+		if (si2->_nearStamp != _nearStamp) {
+			if (addpoint && !nearCount)
+				break;
+			continue;
+		}
+		nearCount--;
+
 		// Doesn't overlap
 		if (si2->_occluded || !si->overlap(*si2))
 			continue;
@@ -216,6 +363,14 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
 
+	// and to the grid
+	int32 x1, y1, x2, y2;
+	GetGridCells(si, x1, y1, x2, y2);
+	for (int32 cy = y1; cy <= y2; cy++) {
+		for (int32 cx = x1; cx <= x2; cx++)
+			_grid[cy * _gridWidth + cx].push_back(si);
+	}
+
 	// have a position
 	//addpoint = 0;
 	if (addpoint) {
@@ -249,6 +404,8 @@ void ItemSorter::AddItem(const Item *add) {
 SortItem *_prev = 0;
 
 void ItemSorter::PaintDisplayList(bool item_highlight) {
+	FinishDisplayList();
+
 	_prev = nullptr;
 	SortItem *it = _items;
 	SortItem *end = nullptr;
@@ -394,6 +551,8 @@ uint16 ItemSorter::Trace(int32 x, int32 y, HitFace *face, bool item_highlight) {
 	SortItem *it;
 	SortItem *selected;
 
+	FinishDisplayList();
+
 	if (!_orderCounter) { // If no _orderCounter we need to sort the _items
 		it = _items;
 		_orderCounter = 0;  // Reset the _orderCounter
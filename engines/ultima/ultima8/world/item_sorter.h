@@ -23,6 +23,9 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "ultima/shared/std/containers.h"
+#include "ultima/ultima8/misc/rect.h"
+
 namespace Ultima {
 namespace Ultima8 {
 
@@ -32,6 +35,20 @@ class RenderSurface;
 struct SortItem;
 
 class ItemSorter {
+	// Arguments of an AddItem call
+	struct ItemArgs {
+		int32 _x, _y, _z;
+		uint32 _shapeNum, _frame, _flags, _extFlags;
+		uint16 _itemNum;
+
+		bool operator==(const ItemArgs &o) const {
+			return _x == o._x && _y == o._y && _z == o._z &&
+			       _shapeNum == o._shapeNum && _frame == o._frame &&
+			       _flags == o._flags && _extFlags == o._extFlags &&
+			       _itemNum == o._itemNum;
+		}
+	};
+
 	MainShapeArchive    *_shapes;
 	RenderSurface   *_surf;
 
@@ -43,6 +60,23 @@ class ItemSorter {
 	int32       _orderCounter;
 
 	int32       _camSx, _camSy;
+	Rect        _clipRect;
+
+	// The items the current list was built from, in the order they were added
+	Std::vector<ItemArgs> _listArgs;
+
+	// While set, every item added so far this frame matches the previous
+	// frame, and the previous sorted list is kept instead of being rebuilt
+	bool        _reusingList;
+	uint        _reuseCount;
+
+	// Screenspace grid over the clip rect, holding the listed items by the
+	// cells their bounding boxes cover. Only items sharing a cell with a new
+	// item can overlap it, so only those get the overlap tests.
+	static const int32 GRID_CELL_SIZE = 64;
+	int32       _gridWidth, _gridHeight;
+	Std::vector<Std::vector<SortItem *> > _grid;
+	uint32      _nearStamp;
 
 public:
 	ItemSorter();
@@ -68,6 +102,15 @@ public:
 	void IncSortLimit(int count);
 
 private:
+	void AddSortItem(const ItemArgs &args);
+	void ClearSortItems();
+	void ClearDisplayList();
+	void ResetGrid();
+	void GetGridCells(const SortItem *si, int32 &x1, int32 &y1, int32 &x2, int32 &y2) const;
+	uint32 MarkNearItems(const SortItem *si);
+	void RebuildDisplayList();
+	void FinishDisplayList();
+
 	bool PaintSortItem(SortItem *);
 	bool NullPaintSortItem(SortItem *);
 };
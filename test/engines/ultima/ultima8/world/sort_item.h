@@ -74,4 +74,44 @@ class U8SortItemTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT(!si2.below(si1));
 	}
 
+	/* Items only overlap when their screenspace extents intersect */
+	void test_screenspace_overlap() {
+		Ultima::Ultima8::SortItem si1(nullptr);
+		Ultima::Ultima8::SortItem si2(nullptr);
+
+		setBox(si1, 128, 128, 0, 128, 128, 32);
+		setBox(si2, 192, 192, 0, 128, 128, 32);
+		TS_ASSERT(si1.overlap(si2));
+		TS_ASSERT(si2.overlap(si1));
+
+		// Touching along the screenspace right edge is not an overlap
+		setBox(si2, 256, 0, 0, 128, 128, 32);
+		TS_ASSERT(si1._sxRight <= si2._sxLeft);
+		TS_ASSERT(!si1.overlap(si2));
+		TS_ASSERT(!si2.overlap(si1));
+
+		// Far above on screen
+		setBox(si2, 128, 128, 256, 128, 128, 32);
+		TS_ASSERT(si2._syBot <= si1._syTop);
+		TS_ASSERT(!si1.overlap(si2));
+		TS_ASSERT(!si2.overlap(si1));
+	}
+
+	private:
+	/* Set the world and screenspace boxes the way ItemSorter does */
+	void setBox(Ultima::Ultima8::SortItem &si, int32 x, int32 y, int32 z, int32 xd, int32 yd, int32 zd) {
+		si._x = x;
+		si._y = y;
+		si._z = z;
+		si._xLeft = x - xd;
+		si._yFar = y - yd;
+		si._zTop = z + zd;
+		si._sxLeft = si._xLeft / 4 - si._y / 4;
+		si._sxRight = si._x / 4 - si._yFar / 4;
+		si._sxTop = si._xLeft / 4 - si._yFar / 4;
+		si._syTop = si._xLeft / 8 + si._yFar / 8 - si._zTop;
+		si._sxBot = si._x / 4 - si._y / 4;
+		si._syBot = si._x / 8 + si._y / 8 - si._z;
+	}
+
 };